@@ -32,17 +32,6 @@ enum IA_TypedWpTree
 
 
 
-// Class to track danger events for processing
-class IA_GroupDangerEvent
-{
-    IA_GroupDangerType m_type;
-    vector m_position;
-    IEntity m_source;
-    float m_intensity;
-    bool m_isSuppressed;
-    int m_time;
-}
-
 // Class to handle async road search for group spawning
 class IA_RoadSearchState
 {
@@ -87,6 +76,18 @@ class IA_RoadSearchState
     }
 }
 
+// What is left of a group while it is virtualized: enough to rebuild it through Spawn()
+class IA_VirtualGroupRecord
+{
+    vector m_position;
+    IA_SquadType m_squadType;
+    int m_aliveCount;
+    IA_GroupTacticalState m_state;
+    vector m_stateTarget;
+    bool m_stateFromAuthority;
+    Faction m_areaFaction;
+}
+
 class IA_AiGroup
 {
     private SCR_AIGroup m_group;
@@ -106,6 +107,20 @@ class IA_AiGroup
     private vector      m_lastOrderPosition;
     private vector      m_lastConfirmedPosition = vector.Zero;
     private int         m_lastOrderTime = 0;
+
+    // Last order AddOrder placed as a waypoint, so SetTacticalState can skip re-issuing it
+    private IA_AiOrder  m_activeOrderType;
+    private vector      m_activeOrderRequested;
+    private bool        m_activeOrderTopPriority;
+    private int         m_activeOrderPriority;
+    private SCR_AIWaypoint m_activeOrderWaypoint;
+    // Requests within this distance of the active order leave it alone
+    private const float ORDER_SAME_POSITION_M = 5.0;
+    // Move-type requests within this distance shift the existing waypoint instead of replacing it
+    private const float ORDER_SHIFT_MAX_M = 40.0;
+    private static int  s_ordersApplied = 0;
+    private static int  s_ordersSuppressed = 0;
+    private static int  s_ordersShifted = 0;
     
     // Vehicle movement state
     private bool        m_isDriving = false;
@@ -128,7 +143,7 @@ class IA_AiGroup
     private int         m_lastDangerEventTime = 0;
     private vector      m_lastDangerPosition = vector.Zero;
     private IEntity     m_lastDangerSource;
-    private ref array<ref IA_GroupDangerEvent> m_dangerEvents = {};
+    private ref IA_DangerModel m_dangerModel = new IA_DangerModel();
     private int         m_consecutiveDangerEvents = 0;
     
     // Reaction system constants and variables
@@ -223,10 +238,27 @@ class IA_AiGroup
     private vector m_staggeredSpawnPos = vector.Zero;
     private IA_Faction m_staggeredSpawnFaction = IA_Faction.NONE;
     private Faction m_staggeredAreaFaction = null;
+    private IA_SpawnPriority m_spawnPriority = IA_SpawnPriority.Garrison;
+    // Queued character spawn; owned by IA_SpawnQueue, null once it finished
+    private IA_GroupUnitsSpawnRequest m_unitsSpawnRequest;
 	
 	// Assassination obj
 	
 	bool m_HVTGroup = false;
+
+    // Virtualization (see IA_AreaInstance.VirtualizationTask)
+    private ref IA_VirtualGroupRecord m_virtualRecord;
+    private bool m_isRematerializing = false;
+    private const int VIRTUALIZE_DANGER_QUIET_S = 60;
+
+    // Alive-unit bookkeeping (see RefreshAliveCount). m_agentCount follows the
+    // SCR_AIGroup's agent add/remove events; the reported values are what the
+    // strength sink (the owning area) last received.
+    private int m_agentCount = 0;
+    private IA_AreaInstance m_strengthSink;
+    private int m_reportedAlive = 0;
+    private int m_reportedWaveAlive = 0;
+    private int m_reportedSpawnedWaveAlive = 0;
 	
     private void IA_AiGroup(vector initialPos, IA_SquadType squad, IA_Faction fac, int unitCount, bool HVTGroup = false)
     {
@@ -343,7 +375,7 @@ class IA_AiGroup
 		}
 		if(m_HVTGroup == true){
 		
-			return "{5117311FB822FD1F}Prefabs/Characters/Factions/OPFOR/USSR_Army/Character_USSR_Officer.et";
+			return IA_PrefabCache.HVT_OFFICER;
 		
 		}
 
@@ -422,6 +454,7 @@ class IA_AiGroup
         IA_AiGroup grp = new IA_AiGroup(initialPos, IA_SquadType.Riflemen, IA_Faction.CIV, 1);
         //grp.m_initialUnitCount = 1; // No longer needed here
         grp.m_isCivilian = true;
+        grp.m_spawnPriority = IA_SpawnPriority.Civilian;
         return grp;
     }
 
@@ -437,26 +470,12 @@ class IA_AiGroup
         if (!passengerOnly)
             grp.m_referencedEntity = vehicle;
 
-		Resource groupRes;
-		switch(faction){
-			case IA_Faction.USSR:
-				groupRes = Resource.Load("{8DE0C0830FE0C33D}Prefabs/Groups/OPFOR/Group_USSR_Base.et");
-				break;
-			case IA_Faction.US:
-				groupRes = Resource.Load("{EACD97CF4A702FAE}Prefabs/Groups/BLUFOR/Group_US_Base.et");
-				break;
-			case IA_Faction.CIV:
-				groupRes = Resource.Load("{71783D1DEDC4E150}Prefabs/Groups/Group_CIV.et");
-				break;
-			case IA_Faction.FIA:
-				groupRes = Resource.Load("{242BC3C6BCE96EA5}Prefabs/Groups/INDFOR/Group_FIA_Base.et");
-				break;
-		}
+		Resource groupRes = LoadGroupResource(faction);
         if (!groupRes) {
             return null;
         }
         IEntity groupEnt = GetGame().SpawnEntityPrefab(groupRes, null, IA_CreateSimpleSpawnParams(spawnPos));
-        grp.m_group = SCR_AIGroup.Cast(groupEnt);
+        grp.BindGroupEntity(SCR_AIGroup.Cast(groupEnt));
 
         if (!grp.m_group) {
             delete groupEnt;
@@ -484,7 +503,7 @@ class IA_AiGroup
         {
             Print("[IA_AiGroup.CreateGroupForVehicle] No usable compartments; discarding empty group.", LogLevel.WARNING);
             IA_Game.AddEntityToGc(grp.m_group);
-            grp.m_group = null;
+            grp.BindGroupEntity(null);
             return null;
         }
 
@@ -497,7 +516,7 @@ class IA_AiGroup
         
         Print(string.Format("[IA_AiGroup.CreateGroupForVehicle] Starting staggered spawning of %1 units for vehicle group faction %2", actualUnitsToSpawn, faction), LogLevel.NORMAL);
         
-        grp.SpawnNextUnit();
+        grp.BeginStaggeredSpawn();
 
         return grp;
     }
@@ -536,9 +555,53 @@ class IA_AiGroup
             searchState.SetCallback(callbackInstance, "OnAsyncGroupCreated");
         }
         
+        // With the area group's road index built, the whole expanding search is a lookup
+        if (!useExactPosition && ResolveRoadSearchFromIndex(searchState))
+        {
+            CompleteAsyncGroupCreation(searchState);
+            return;
+        }
+
         // Start the search
         GetGame().GetCallqueue().CallLater(PerformNextRoadSearch, IA_RoadSearchState.SEARCH_DELAY_MS, false, searchState);
     }
+
+    // Same outcome as the PerformNextRoadSearch chain in one call: a random road point
+    // within the smallest search distance that has one. False if the index can't answer.
+    static bool ResolveRoadSearchFromIndex(IA_RoadSearchState searchState)
+    {
+        int lastIndex = searchState.m_searchDistances.Count() - 1;
+        float maxDistance = searchState.m_searchDistances[lastIndex];
+        IA_RoadPointIndex roadIndex = IA_RoadPointIndex.GetIfCovers(searchState.m_initialPos, maxDistance, searchState.m_activeGroup);
+        if (!roadIndex)
+            return false;
+
+        vector nearest = roadIndex.Nearest(searchState.m_initialPos, maxDistance);
+        if (nearest == vector.Zero)
+        {
+            // The alternative phase never reaches past the last distance either
+            searchState.m_foundSpawnPos = searchState.m_initialPos;
+            searchState.m_roadFound = false;
+            Print(string.Format("[IA_AiGroup.ResolveRoadSearchFromIndex] WARNING: No road within %1m of %2. Using initial position.",
+                maxDistance, searchState.m_initialPos.ToString()), LogLevel.WARNING);
+            return true;
+        }
+
+        float nearestDist = vector.DistanceXZ(searchState.m_initialPos, nearest);
+        searchState.m_foundSpawnPos = nearest;
+        foreach (int searchDistance : searchState.m_searchDistances)
+        {
+            if (searchDistance < nearestDist)
+                continue;
+
+            vector roadPos = roadIndex.RandomInRadius(searchState.m_initialPos, searchDistance);
+            if (roadPos != vector.Zero)
+                searchState.m_foundSpawnPos = roadPos;
+            break;
+        }
+        searchState.m_roadFound = true;
+        return true;
+    }
     
     // Perform one step of the road search
     static void PerformNextRoadSearch(IA_RoadSearchState searchState)
@@ -662,6 +725,21 @@ class IA_AiGroup
 	
 	
     
+    private static Resource LoadGroupResource(IA_Faction faction)
+    {
+        switch(faction){
+            case IA_Faction.USSR:
+                return IA_PrefabCache.Load(IA_PrefabCache.GROUP_USSR_BASE);
+            case IA_Faction.US:
+                return IA_PrefabCache.Load(IA_PrefabCache.GROUP_US_BASE);
+            case IA_Faction.CIV:
+                return IA_PrefabCache.Load(IA_PrefabCache.GROUP_CIV);
+            case IA_Faction.FIA:
+                return IA_PrefabCache.Load(IA_PrefabCache.GROUP_FIA_BASE);
+        }
+        return null;
+    }
+
     // Create a military group at a specific position (no road search)
     static IA_AiGroup CreateMilitaryGroupAtPosition(vector spawnPos, IA_Faction faction, int unitCount, Faction AreaFaction, bool HVTGroup = false, bool useExactPosition = false)
     {
@@ -691,29 +769,14 @@ class IA_AiGroup
         IA_AiGroup grp = new IA_AiGroup(finalSpawnPos, IA_SquadType.Riflemen, faction, unitCount, HVTGroup);
         grp.m_isCivilian = false;
 
-        Resource groupRes;
-        switch(faction){
-            case IA_Faction.USSR:
-                groupRes = Resource.Load("{8DE0C0830FE0C33D}Prefabs/Groups/OPFOR/Group_USSR_Base.et");
-                break;
-            case IA_Faction.US:
-                groupRes = Resource.Load("{EACD97CF4A702FAE}Prefabs/Groups/BLUFOR/Group_US_Base.et");
-                break;
-            case IA_Faction.CIV:
-                groupRes = Resource.Load("{71783D1DEDC4E150}Prefabs/Groups/Group_CIV.et");
-                break;
-            case IA_Faction.FIA:
-                groupRes = Resource.Load("{242BC3C6BCE96EA5}Prefabs/Groups/INDFOR/Group_FIA_Base.et");
-                break;
-        }
-
+        Resource groupRes = LoadGroupResource(faction);
         if (!groupRes) {
             Print(string.Format("[IA_AiGroup.CreateMilitaryGroupAtPosition] Failed to load group resource for faction %1", faction), LogLevel.ERROR);
             return null;
         }
 
         IEntity groupEnt = GetGame().SpawnEntityPrefab(groupRes, null, IA_CreateSimpleSpawnParams(finalSpawnPos));
-        grp.m_group = SCR_AIGroup.Cast(groupEnt);
+        grp.BindGroupEntity(SCR_AIGroup.Cast(groupEnt));
 
         if (!grp.m_group) {
             delete groupEnt;
@@ -738,7 +801,7 @@ class IA_AiGroup
         
         Print(string.Format("[IA_AiGroup.CreateMilitaryGroupAtPosition] Starting staggered spawning of %1 units for faction %2 at %3", unitCount, faction, finalSpawnPos.ToString()), LogLevel.NORMAL);
         
-        grp.SpawnNextUnit();
+        grp.BeginStaggeredSpawn();
 
         return grp;
     }
@@ -834,47 +897,16 @@ class IA_AiGroup
         ////Print("[DEBUG] IA_AiGroup.AddWaypoint: Waypoint added to internal SCR_AIGroup.", LogLevel.NORMAL);
     }
 
-    void AddOrder(vector origin, IA_AiOrder order, bool topPriority = false)
+    // Keeps infantry waypoints inside the zone the group stands in: points beyond 80% of
+    // the radius are redirected to a random point within it, and the height is put on the
+    // surface unless that is far above or below the zone origin.
+    private vector ClampOrderToZone(vector origin, IA_AiOrder order)
     {
-        // Store last order data
-        m_lastOrderPosition = origin;
-        m_lastOrderTime = System.GetUnixTime();
-        
-        // Driving groups keep Move/drive on the vehicle ticker. GetIn/GetOut
-        // must still become waypoints or passengers never dump and stragglers
-        // never remount.
-        if (m_isDriving && order != IA_AiOrder.GetInVehicle && order != IA_AiOrder.GetOutOfVehicle)
-        {
-            UpdateVehicleOrders();
-            return;
-        }
-        
-        if (!m_isSpawned)
-        {
-            return;
-        }
-        if (!m_group)
-        {
-            return;
-        }
-
-        if (!m_flushingTypedClear && ShouldDeferOrderForTypedTree(order))
-        {
-            QueuePendingOrder(origin, order, topPriority);
-            PrepareTypedWaypointTreeClear();
-            return;
-        }
-
-        if (OrderMatchesActiveTypedTree(order))
-            CancelPendingTypedClear();
 		vector zoneOrigin;
 		float zoneRadius;
         // Restrict infantry waypoints to a single zone, while vehicle waypoints can navigate across the zone group
         if (!m_isDriving && order != IA_AiOrder.GetInVehicle)
         {
-            // Get the current group number from VehicleManager's active group
-            int currentGroupNumber = IA_VehicleManager.GetActiveGroup();
-            
             // Find the closest zone to the current group position
             IA_AreaMarker closestMarker = IA_AreaMarker.GetMarkerAtPosition(m_group.GetOrigin());
             
@@ -896,12 +928,6 @@ class IA_AiGroup
         }
         // Adjust spawn height based on terrain
         float y = GetGame().GetWorld().GetSurfaceY(origin[0], origin[2]);
-		
-
-		
-		
-		
-		
         origin[1] = y + 0.5;
 		if(zoneOrigin && zoneRadius)
 		{
@@ -910,6 +936,57 @@ class IA_AiGroup
 			if(yDiff > zoneRadius*0.25) // Add logic to check if the origin's Y value is farther away from the Area's Origin Point than the Area's Radius.
 				origin[1] = zoneOrigin[1];
 		}
+        return origin;
+    }
+
+    // For vehicle orders, snap to nearest road - EXCEPT GetIn/GetOut which go to the hull
+    private vector SnapOrderToRoad(vector origin, IA_AiOrder order)
+    {
+        if (m_isDriving && order != IA_AiOrder.GetInVehicle && order != IA_AiOrder.GetOutOfVehicle)
+        {
+            int currentActiveGroup = IA_VehicleManager.GetActiveGroup();
+            vector roadOrigin = IA_VehicleManager.FindRandomRoadEntityInZone(origin, 300, currentActiveGroup);
+            if (roadOrigin != vector.Zero)
+                origin = roadOrigin;
+        }
+        return origin;
+    }
+
+    void AddOrder(vector origin, IA_AiOrder order, bool topPriority = false)
+    {
+        // Store last order data
+        m_lastOrderPosition = origin;
+        m_lastOrderTime = System.GetUnixTime();
+        
+        // Driving groups keep Move/drive on the vehicle ticker. GetIn/GetOut
+        // must still become waypoints or passengers never dump and stragglers
+        // never remount.
+        if (m_isDriving && order != IA_AiOrder.GetInVehicle && order != IA_AiOrder.GetOutOfVehicle)
+        {
+            UpdateVehicleOrders();
+            return;
+        }
+        
+        if (!m_isSpawned)
+        {
+            return;
+        }
+        if (!m_group)
+        {
+            return;
+        }
+
+        if (!m_flushingTypedClear && ShouldDeferOrderForTypedTree(order))
+        {
+            QueuePendingOrder(origin, order, topPriority);
+            PrepareTypedWaypointTreeClear();
+            return;
+        }
+
+        if (OrderMatchesActiveTypedTree(order))
+            CancelPendingTypedClear();
+
+        origin = ClampOrderToZone(origin, order);
 		
         // --- BEGIN WATER CHECK ---
         if (WaterCheck(origin))
@@ -924,18 +1001,7 @@ class IA_AiGroup
         }
         // --- END WATER CHECK ---
 		
-        // For vehicle orders, snap to nearest road - EXCEPT GetIn/GetOut which go to the hull
-        if (m_isDriving && order != IA_AiOrder.GetInVehicle && order != IA_AiOrder.GetOutOfVehicle)
-        {
-
-            int currentActiveGroup = IA_VehicleManager.GetActiveGroup();
-            vector roadOrigin = IA_VehicleManager.FindRandomRoadEntityInZone(origin, 300, currentActiveGroup);
-            if (roadOrigin != vector.Zero)
-            {
-                origin = roadOrigin;
-            }
-            
-        }
+        origin = SnapOrderToRoad(origin, order);
 
         ResourceName rname;
         // Special handling for Defend orders to prevent errors
@@ -1014,8 +1080,9 @@ class IA_AiGroup
         //    m_group, typename.EnumToString(IA_AiOrder, order), rname, origin), LogLevel.NORMAL);
         // --- END ADDED LOGGING ---
         
-        Resource res = Resource.Load(rname);
-        if (!res)
+        // Parked waypoint of this prefab if the pool has one, otherwise a new spawn
+        IEntity waypointEnt = IA_WaypointPool.Acquire(rname, origin);
+        if (!waypointEnt)
         {
             // --- BEGIN ADDED LOGGING ---
             //Print(string.Format("[IA_Waypoint] Failed to load waypoint resource: %1 for Group %2", rname, m_group), LogLevel.ERROR);
@@ -1023,7 +1090,6 @@ class IA_AiGroup
             return;
         }
 
-        IEntity waypointEnt = GetGame().SpawnEntityPrefab(res, null, IA_CreateSimpleSpawnParams(origin));
         SCR_AIWaypoint w = null; // Initialize w to null
 
         if (order == IA_AiOrder.Defend || order == IA_AiOrder.DefendSmall)
@@ -1077,7 +1143,7 @@ class IA_AiGroup
 
         if (!w) // This single check now covers failure from either cast, or if waypointEnt itself was null (though SpawnEntityPrefab usually handles that)
         {
-            if (waypointEnt) IA_Game.AddEntityToGc(waypointEnt); // Ensure waypointEnt is GC'd if it was created but cast failed
+            IA_WaypointPool.Release(AIWaypoint.Cast(waypointEnt)); // Cast failed; hand it back unused
             return;
         }
 
@@ -1149,6 +1215,13 @@ class IA_AiGroup
         // --- END ADDED ---
 
         m_group.AddWaypointToGroup(w);
+        s_ordersApplied++;
+
+        m_activeOrderType = order;
+        m_activeOrderRequested = m_lastOrderPosition;
+        m_activeOrderTopPriority = topPriority;
+        m_activeOrderPriority = w.GetPriorityLevel();
+        m_activeOrderWaypoint = w;
         
         // --- BEGIN ADDED LOGGING ---
         //Print(string.Format("[IA_Waypoint] Added Order: %1 at %2 for Group %3", typename.EnumToString(IA_AiOrder, order), origin, m_group), LogLevel.WARNING);
@@ -1193,7 +1266,11 @@ class IA_AiGroup
         foreach (AIWaypoint w : wps)
         {
             m_group.RemoveWaypoint(w);
+            if (AIWaypoint.Cast(m_artilleryFireWaypoint) == w)
+                m_artilleryFireWaypoint = null;
+            IA_WaypointPool.Release(w);
         }
+        m_activeOrderWaypoint = null;
         
         // Reset flanking phase state when all orders are removed
         if (m_isInFlankingPhase)
@@ -1226,6 +1303,8 @@ class IA_AiGroup
 
     int GetAliveCount()
     {
+        if (m_virtualRecord)
+            return m_virtualRecord.m_aliveCount;
         if (!m_isSpawned)
         {
             if (m_isCivilian)
@@ -1242,12 +1321,98 @@ class IA_AiGroup
         {	
             return 0;
         }
-        int aliveCount = m_group.GetPlayerAndAgentCount();
-        return aliveCount;
+        return m_agentCount;
+    }
+
+    // Every m_group assignment goes through here so the agent counter follows the entity.
+    private void BindGroupEntity(SCR_AIGroup groupEntity)
+    {
+        if (m_group)
+        {
+            m_group.GetOnAgentAdded().Remove(OnGroupAgentAdded);
+            m_group.GetOnAgentRemoved().Remove(OnGroupAgentRemoved);
+        }
+
+        m_group = groupEntity;
+        m_agentCount = 0;
+        if (m_group)
+        {
+            m_group.GetOnAgentAdded().Insert(OnGroupAgentAdded);
+            m_group.GetOnAgentRemoved().Insert(OnGroupAgentRemoved);
+            m_agentCount = m_group.GetPlayerAndAgentCount();
+        }
+        RefreshAliveCount();
+    }
+
+    private void OnGroupAgentAdded(AIAgent child)
+    {
+        m_agentCount++;
+        RefreshAliveCount();
+    }
+
+    // Deaths land here too: a dead member's agent leaves the group.
+    private void OnGroupAgentRemoved(SCR_AIGroup group, AIAgent child)
+    {
+        if (group != m_group)
+            return;
+        m_agentCount = Math.Max(m_agentCount - 1, 0);
+        RefreshAliveCount();
+    }
+
+    // Routes this group's alive counts into `area`'s totals, taking them out of the previous sink.
+    void AttachStrengthSink(IA_AreaInstance area)
+    {
+        if (m_strengthSink == area)
+            return;
+
+        DetachStrengthSink(m_strengthSink);
+        m_strengthSink = area;
+        RefreshAliveCount();
+    }
+
+    void DetachStrengthSink(IA_AreaInstance area)
+    {
+        if (!m_strengthSink || m_strengthSink != area)
+            return;
+
+        m_strengthSink.OnGroupStrengthDelta(-m_reportedAlive, -m_reportedWaveAlive, -m_reportedSpawnedWaveAlive);
+        m_strengthSink = null;
+        m_reportedAlive = 0;
+        m_reportedWaveAlive = 0;
+        m_reportedSpawnedWaveAlive = 0;
+    }
+
+    // Pushes the change in GetAliveCount (and its defend-wave share) to the sink. Called
+    // on every event that can change it: agents joining or leaving, spawn, despawn,
+    // virtualization and the defend-wave flag.
+    private void RefreshAliveCount()
+    {
+        if (!m_strengthSink)
+            return;
+
+        int alive = GetAliveCount();
+        int waveAlive = 0;
+        int spawnedWaveAlive = 0;
+        if (m_isDefendWaveGroup)
+        {
+            waveAlive = alive;
+            if (m_isSpawned)
+                spawnedWaveAlive = alive;
+        }
+
+        if (alive == m_reportedAlive && waveAlive == m_reportedWaveAlive && spawnedWaveAlive == m_reportedSpawnedWaveAlive)
+            return;
+
+        m_strengthSink.OnGroupStrengthDelta(alive - m_reportedAlive, waveAlive - m_reportedWaveAlive, spawnedWaveAlive - m_reportedSpawnedWaveAlive);
+        m_reportedAlive = alive;
+        m_reportedWaveAlive = waveAlive;
+        m_reportedSpawnedWaveAlive = spawnedWaveAlive;
     }
 
     vector GetOrigin()
     {
+        if (m_virtualRecord)
+            return m_virtualRecord.m_position;
         if (!m_group)
         {
             return vector.Zero;
@@ -1356,13 +1521,13 @@ class IA_AiGroup
             }
             
             // Create the SCR_AIGroup entity for the civilian
-            Resource groupPrefabRes = Resource.Load("{71783D1DEDC4E150}Prefabs/Groups/Group_CIV.et");
+            Resource groupPrefabRes = IA_PrefabCache.Load(IA_PrefabCache.GROUP_CIV);
             if (!groupPrefabRes)
             {
                  return false;
             }
             IEntity groupEntity = GetGame().SpawnEntityPrefab(groupPrefabRes, null, IA_CreateSimpleSpawnParams(spawnPos));
-            m_group = SCR_AIGroup.Cast(groupEntity);
+            BindGroupEntity(SCR_AIGroup.Cast(groupEntity));
 
             if (!m_group)
             {
@@ -1372,7 +1537,7 @@ class IA_AiGroup
             
             // Restore old spawning logic - spawn civilian directly
             string resourceName = IA_RandomCivilianResourceName();
-            Resource charRes = Resource.Load(resourceName);
+            Resource charRes = IA_PrefabCache.Load(resourceName);
             if (!charRes)
             {
                 return false;
@@ -1389,7 +1554,7 @@ class IA_AiGroup
             {
                 IA_Game.AddEntityToGc(charEntity); // Clean up character
                 IA_Game.AddEntityToGc(m_group);    // Clean up the group as well since it's unusable
-                m_group = null;
+                BindGroupEntity(null);
                 return false;
             }
             // If successfully added, setup death listener for this specific unit
@@ -1418,6 +1583,7 @@ class IA_AiGroup
         }
 
         m_isSpawned = true; // Set spawned to true only after successful creation/validation of entities and group
+        RefreshAliveCount();
 
         vector groundPos;
         if (m_initialPosition != vector.Zero) { 
@@ -1534,17 +1700,17 @@ class IA_AiGroup
         // --- Infantry specific handling (original logic) ---
         m_consecutiveDangerEvents++;
         
-        // Create a danger event for later processing (infantry only)
-        IA_GroupDangerEvent dangerEvent = new IA_GroupDangerEvent();
-        dangerEvent.m_type = dangerType;
-        dangerEvent.m_position = position;
-        dangerEvent.m_source = sourceEntity;
-        dangerEvent.m_intensity = intensity;
-        dangerEvent.m_isSuppressed = isSuppressed;
-        dangerEvent.m_time = m_lastDangerEventTime;
-        
-        // Add to queue (infantry only)
-        m_dangerEvents.Insert(dangerEvent);
+        float weight = intensity;
+        if (isSuppressed)
+            weight *= 0.5;
+
+        // Only shots, explosions and sightings locate the threat; impacts and flybys just add danger
+        bool positional = dangerType == IA_GroupDangerType.WeaponFire
+            || dangerType == IA_GroupDangerType.Explosion
+            || dangerType == IA_GroupDangerType.EnemySpotted;
+
+        // Record into the ring (infantry only)
+        m_dangerModel.Record(position, weight, positional, System.GetTickCount());
         
         // Update danger level (infantry only)
         EvaluateDangerState(); 
@@ -1552,7 +1718,7 @@ class IA_AiGroup
     
     void ResetDangerState()
     {
-        m_dangerEvents.Clear();
+        m_dangerModel.Clear();
         m_currentDangerLevel = 0.0;
         m_consecutiveDangerEvents = 0;
         m_lastDangerEventTime = 0;
@@ -1587,100 +1753,26 @@ class IA_AiGroup
     
     private void EvaluateDangerState()
     {
-        // Early exit if there are no danger events to process
-        if (m_dangerEvents.IsEmpty())
+        int nowMs = System.GetTickCount();
+
+        // Early exit if no danger event is recent enough to count
+        if (!m_dangerModel.HasRecent(nowMs))
         {
             m_currentDangerLevel = 0.0;
             m_consecutiveDangerEvents = 0;
             return;
         }
         
-        // Current time to calculate recency
-        int currentTime = System.GetUnixTime();
-        
-        // Calculate the combined danger level from all events
-        float dangerLevel = 0.0;
-        
-        // First collect only weapon fire events for position calculation
-        // Collect relevant positions for median calculation
-        array<vector> relevantPositions = {};
-        
-        // Process all danger events, but weigh recent events higher
-        foreach (IA_GroupDangerEvent dangerEvent : m_dangerEvents)
-        {
-            // Calculate how recent this event is (0-30 seconds)
-            int timeSince = currentTime - dangerEvent.m_time;
-            
-            // Events older than 30 seconds have minimal impact
-            if (timeSince > 30)
-                continue;
-                
-            // Calculate recency factor (1.0 for now, 0.0 for 30 seconds ago)
-            float recencyFactor = 1.0 - (timeSince / 30.0);
-            
-            // Calculate weight based on intensity and recency
-            float weight = dangerEvent.m_intensity * recencyFactor;
-            
-            // Apply suppression modifier if applicable
-            if (dangerEvent.m_isSuppressed)
-                weight *= 0.5;
-                
-            // Add to total danger level regardless of event type
-            dangerLevel += weight;
-            
-            // Special handling for WeaponFire events - track them separately
-            if (dangerEvent.m_type == IA_GroupDangerType.WeaponFire ||
-                dangerEvent.m_type == IA_GroupDangerType.Explosion ||
-                dangerEvent.m_type == IA_GroupDangerType.EnemySpotted)
-            {
-                // Only consider recent events for position
-                if (recencyFactor > 0) // Equivalent to timeSince <= 30
-                {
-                    relevantPositions.Insert(dangerEvent.m_position);
-                }
-            }
-            
-            // Update consecutive events for compatibility with old system
-            m_consecutiveDangerEvents++;
-        }
-        
-        // Normalize the danger level (cap at 1.0)
-        dangerLevel = Math.Clamp(dangerLevel, 0.0, 1.0);
-        
-        // Prioritize weapon fire events for danger center position
-        // Calculate median position if there are relevant events
-        int posCount = relevantPositions.Count();
-        if (posCount > 0)
-        {
-            // Sort positions by x-coordinate to find the median
-            // Note: This is a simplified median based on one axis.
-            IA_VectorUtils.SortVectorsByX(relevantPositions);
-            
-            // Find the middle index
-            int medianIndex = posCount / 2;
-            
-            // Set the last danger position to the median position
-            m_lastDangerPosition = relevantPositions[medianIndex];
-        }
-        else
-        {
-            // No relevant recent danger events, reset position
-            // Keep the existing logic for danger level, but reset position if no source points found.
-            // Or should we keep the last known position? Resetting seems safer if no current threat loc.
-            m_lastDangerPosition = vector.Zero;
-        }
-        
-        // Update the current danger level
-        m_currentDangerLevel = dangerLevel;
-        
-        // Clear old events
-        for (int i = m_dangerEvents.Count() - 1; i >= 0; i--)
-        {
-            if (currentTime - m_dangerEvents[i].m_time > 30)
-            {
-                m_dangerEvents.Remove(i);
-            }
-        }
+        m_currentDangerLevel = m_dangerModel.GetLevel(nowMs);
+
+        // Streaming median of recent shots/explosions/sightings; zero if none are recent
+        m_lastDangerPosition = m_dangerModel.GetMedianPosition(nowMs);
+    }
+
+    //! Recent threat positions (weapon fire, explosions, sightings), newest first.
+    int GetRecentDangerPositions(notnull array<vector> outPositions)
+    {
+        return m_dangerModel.GetRecentPositions(outPositions, System.GetTickCount());
     }
 
     private void SetupDeathListenerForUnit(IEntity unitEntity)
@@ -1918,6 +2010,12 @@ class IA_AiGroup
             
             if (!handleEvent || intensity <= 0.0)
                 continue;
+
+            // The shared threat map takes every event; ProcessDangerEvent below is rate limited
+            vector threatPos = dangerVector;
+            if (sourceEntity)
+                threatPos = sourceEntity.GetOrigin();
+            IA_ThreatMap.RecordEvent(threatPos, intensity);
                 
             ProcessDangerEvent(mappedDangerType, dangerVector, sourceEntity, intensity, isSuppressed);
         }
@@ -2146,6 +2244,10 @@ class IA_AiGroup
         if (m_isDriving || m_isVehicleCrewGroup)
             return true;
 
+        // A virtual group has no agents to move; it takes orders again once re-materialized.
+        if (m_virtualRecord)
+            return true;
+
         if (m_isVehiclePassengerGroup && !m_passengerDumped)
             return true;
 
@@ -2615,6 +2717,8 @@ class IA_AiGroup
             boarding.SetAllowance(false, false, true);
         else if (m_isVehicleCrewGroup)
             boarding.SetAllowance(true, true, false);
+        else
+            boarding.SetAllowance(true, true, true); // Pooled waypoints keep the previous group's allowance
     }
 
     protected void TryDumpPassengersIfNeeded()
@@ -3252,14 +3356,176 @@ class IA_AiGroup
         // by the updated SetTacticalState logic for IA_GroupTacticalState.InVehicle.
     }
 
+    bool IsVirtualized()
+    {
+        return m_virtualRecord != null;
+    }
+
+    bool IsRematerializing()
+    {
+        return m_isRematerializing;
+    }
+
+    // Plain infantry that is settled and quiet. Anything tied to a vehicle, an objective,
+    // a defend wave or a pending spawn keeps its live group.
+    bool CanVirtualize()
+    {
+        if (!m_isSpawned || !m_group || m_virtualRecord)
+            return false;
+        if (m_isCivilian || m_faction == IA_Faction.CIV || m_faction == IA_Faction.NONE)
+            return false;
+        if (m_HVTGroup || m_isMortarCrew || m_OwningSideObjective || m_isInDefendMode || m_isDefendWaveGroup)
+            return false;
+        if (m_isDriving || m_referencedEntity || m_isVehicleCrewGroup || m_isVehiclePassengerGroup || m_linkedCrewGroup || m_linkedPassengerGroup)
+            return false;
+        if (m_pendingUnitsToSpawn > 0 || m_bInboundSimPinned || m_typedClearScheduled)
+            return false;
+
+        switch (m_tacticalState)
+        {
+            case IA_GroupTacticalState.Neutral:
+            case IA_GroupTacticalState.Defending:
+            case IA_GroupTacticalState.DefendPatrol:
+                break;
+            default:
+                return false;
+        }
+
+        if (IsEngagedWithEnemy())
+            return false;
+        if (m_lastDangerEventTime > 0 && System.GetUnixTime() - m_lastDangerEventTime < VIRTUALIZE_DANGER_QUIET_S)
+            return false;
+
+        return GetAliveCount() > 0;
+    }
+
+    // Collapses the live group into a record and deletes its entities. The IA_AiGroup
+    // stays in its area's lists; GetOrigin/GetAliveCount answer from the record.
+    bool Virtualize()
+    {
+        if (!CanVirtualize())
+            return false;
+
+        IA_VirtualGroupRecord record = new IA_VirtualGroupRecord();
+        record.m_position = GetOrigin();
+        record.m_squadType = m_squadType;
+        record.m_aliveCount = GetAliveCount();
+        record.m_state = m_tacticalState;
+        record.m_stateTarget = m_tacticalStateTarget;
+        record.m_stateFromAuthority = m_isStateManagedByAuthority;
+        record.m_areaFaction = m_group.GetFaction();
+
+        // Despawn only retires the SCR_AIGroup; the members have to go too.
+        array<SCR_ChimeraCharacter> members = GetGroupCharacters();
+
+        GetGame().GetCallqueue().Remove(CheckDangerEvents);
+        Despawn();
+        foreach (SCR_ChimeraCharacter member : members)
+        {
+            if (member)
+                IA_Game.AddEntityToGc(member);
+        }
+        ResetDangerState();
+        m_virtualRecord = record;
+        RefreshAliveCount();
+        return true;
+    }
+
+    // Rebuilds the SCR_AIGroup at the recorded position with the recorded head count.
+    // Units arrive through the staggered spawner; FinishRematerialize runs Spawn().
+    bool Rematerialize()
+    {
+        if (!m_virtualRecord || m_isRematerializing)
+            return false;
+
+        Resource groupRes = LoadGroupResource(m_faction);
+        if (!groupRes)
+            return false;
+
+        vector groundPos = m_virtualRecord.m_position;
+        groundPos[1] = GetGame().GetWorld().GetSurfaceY(groundPos[0], groundPos[2]);
+
+        IEntity groupEnt = GetGame().SpawnEntityPrefab(groupRes, null, IA_CreateSimpleSpawnParams(groundPos));
+        BindGroupEntity(SCR_AIGroup.Cast(groupEnt));
+        if (!m_group)
+        {
+            if (groupEnt)
+                IA_Game.AddEntityToGc(groupEnt);
+            Print(string.Format("[IA_AiGroup.Rematerialize] Failed to create SCR_AIGroup at %1", groundPos.ToString()), LogLevel.ERROR);
+            return false;
+        }
+        m_group.SetOrigin(groundPos);
+
+        m_isRematerializing = true;
+        m_pendingUnitsToSpawn = m_virtualRecord.m_aliveCount;
+        m_unitsSpawnedCount = 0;
+        m_staggeredSpawnPos = groundPos;
+        m_staggeredSpawnFaction = m_faction;
+        m_staggeredAreaFaction = m_virtualRecord.m_areaFaction;
+        BeginStaggeredSpawn();
+        return true;
+    }
+
+    private void FinishRematerialize()
+    {
+        IA_VirtualGroupRecord record = m_virtualRecord;
+        m_virtualRecord = null;
+        RefreshAliveCount();
+        m_isRematerializing = false;
+        m_staggeredSpawnPos = vector.Zero;
+        m_staggeredSpawnFaction = IA_Faction.NONE;
+        m_staggeredAreaFaction = null;
+
+        IA_AiOrder order = IA_AiOrder.Patrol;
+        if (record.m_state == IA_GroupTacticalState.Defending)
+            order = IA_AiOrder.Defend;
+
+        vector target = record.m_stateTarget;
+        if (target == vector.Zero)
+            target = record.m_position;
+
+        // PerformSpawn grounds the group at m_initialPosition; keep it where it was recorded.
+        vector homePosition = m_initialPosition;
+        m_initialPosition = record.m_position;
+        Spawn(order, target);
+        m_initialPosition = homePosition;
+
+        if (m_isInDefendMode && m_defendTarget != vector.Zero)
+        {
+            SetDefendMode(true, m_defendTarget);
+            return;
+        }
+
+        if (m_tacticalState != record.m_state)
+            SetTacticalState(record.m_state, target, null, record.m_stateFromAuthority);
+        else if (record.m_stateFromAuthority)
+            m_isStateManagedByAuthority = true;
+    }
+
     void Despawn()
     {
+        // Ambient civilians may still be waiting in the spawn queue.
+        if (m_isCivilian && !IsSpawned())
+            IA_SpawnQueue.Get().Cancel(this);
+
+        m_virtualRecord = null;
+        RefreshAliveCount();
+        if (m_isRematerializing)
+        {
+            // Units still streaming in; FinalizeStaggeredSpawn discards a group with no SCR_AIGroup.
+            m_isRematerializing = false;
+            m_pendingUnitsToSpawn = 0;
+            IA_Game.AddEntityToGc(m_group);
+            BindGroupEntity(null);
+            return;
+        }
         if (!IsSpawned())
         {
             return;
         }
         UnpinInboundSimulation();
         m_isSpawned = false;
+        RefreshAliveCount();
         
         if (m_isDriving || m_referencedEntity)
         {
@@ -3281,7 +3547,7 @@ class IA_AiGroup
         }
         RemoveAllOrders();
         IA_Game.AddEntityToGc(m_group);
-        m_group = null;
+        BindGroupEntity(null);
     }
 
     // Add a public SetTacticalState method to replace the one we accidentally removed
@@ -3322,7 +3588,17 @@ class IA_AiGroup
 
         m_tacticalState = newState;
         m_tacticalStateTarget = targetPos;
+        if (m_virtualRecord)
+        {
+            m_virtualRecord.m_state = newState;
+            m_virtualRecord.m_stateTarget = targetPos;
+            m_virtualRecord.m_stateFromAuthority = fromAuthority;
+        }
         
+        // Same single-waypoint order as the one the group is already running: keep it
+        if (TryKeepActiveOrder(m_tacticalState, targetPos))
+            return;
+
         // Apply orders based on the state.
         // Approaching is the exception: arc routing waypoints were already queued externally,
         // so we must NOT wipe them here. All other states get a clean slate.
@@ -3358,13 +3634,7 @@ class IA_AiGroup
                 //Print(string.Format("[IA_AiGroup.SetTacticalState] DEFEND ORDER DEBUG: Group %1 | Faction: %2 | AliveCount: %3 | Position: %4 | Target: %5", 
                 //    this, m_faction, GetAliveCount(), m_lastConfirmedPosition.ToString(), defendPos.ToString()), LogLevel.NORMAL);
                 
-                // Add some vertical offset to avoid waypoints in ground
-                if (defendPos[1] < 5)
-                {
-                    defendPos[1] = defendPos[1] + 0.5;
-                }
-                
-                AddOrder(defendPos, IA_AiOrder.Defend, true);
+                AddOrder(GetDefendOrderPosition(defendPos), IA_AiOrder.Defend, true);
                 break;
                 
             case IA_GroupTacticalState.Flanking:
@@ -3445,6 +3715,100 @@ class IA_AiGroup
         }
     }
 
+    // Defend waypoints get some vertical offset to avoid placing them in the ground
+    private vector GetDefendOrderPosition(vector defendPos)
+    {
+        if (defendPos[1] < 5)
+        {
+            defendPos[1] = defendPos[1] + 0.5;
+        }
+        return defendPos;
+    }
+
+    // Diffs the order a single-waypoint state would issue against the active one.
+    // True if the active waypoint already satisfies it (untouched, or shifted for
+    // small Move/SearchAndDestroy/PriorityMove changes); false means re-issue as usual.
+    private bool TryKeepActiveOrder(IA_GroupTacticalState state, vector targetPos)
+    {
+        IA_AiOrder order;
+        vector requested;
+        switch (state)
+        {
+            case IA_GroupTacticalState.Attacking:
+                order = IA_AiOrder.SearchAndDestroy;
+                requested = targetPos;
+                break;
+            case IA_GroupTacticalState.Defending:
+                order = IA_AiOrder.Defend;
+                requested = targetPos;
+                if (requested == vector.Zero)
+                    requested = m_lastConfirmedPosition;
+                requested = GetDefendOrderPosition(requested);
+                break;
+            case IA_GroupTacticalState.Escaping:
+                order = IA_AiOrder.PriorityMove;
+                requested = targetPos;
+                break;
+            default:
+                // Flanking and patrol pick fresh positions every time; vehicles run on their own ticker
+                return false;
+        }
+
+        if (requested == vector.Zero || !m_isSpawned || !m_group || m_isDriving)
+            return false;
+        if (!m_activeOrderWaypoint || m_activeOrderType != order || !m_activeOrderTopPriority)
+            return false;
+        if (m_typedClearScheduled || !m_pendingOrderTypes.IsEmpty() || !m_pendingWaypoints.IsEmpty())
+            return false;
+        if (m_activeOrderWaypoint.GetPriorityLevel() != m_activeOrderPriority)
+            return false;
+
+        array<AIWaypoint> wps = {};
+        m_group.GetWaypoints(wps);
+        if (wps.Count() != 1 || wps[0] != m_activeOrderWaypoint)
+            return false;
+
+        float dist = vector.DistanceXZ(requested, m_activeOrderRequested);
+        if (dist <= ORDER_SAME_POSITION_M)
+        {
+            s_ordersSuppressed++;
+            m_lastOrderTime = System.GetUnixTime();
+            return true;
+        }
+
+        // Defend waypoints pick their positions when activated; moving one does nothing useful
+        if (order == IA_AiOrder.Defend || dist > ORDER_SHIFT_MAX_M)
+            return false;
+
+        // Same zone clamp and road snap AddOrder applies; a point those would move
+        // elsewhere goes through the full re-issue instead
+        vector shifted = ClampOrderToZone(requested, order);
+        if (vector.DistanceXZ(shifted, requested) > 0.01)
+            return false;
+        if (WaterCheck(shifted))
+            return false;
+        vector snapped = SnapOrderToRoad(shifted, order);
+        if (vector.DistanceXZ(snapped, shifted) > 0.01)
+            return false;
+
+        m_activeOrderWaypoint.SetOrigin(shifted);
+        m_activeOrderRequested = requested;
+        m_lastOrderPosition = requested;
+        m_lastOrderTime = System.GetUnixTime();
+        s_ordersShifted++;
+        return true;
+    }
+
+    // One line for the admin performance readout
+    static string GetOrderReportLine()
+    {
+        int total = s_ordersApplied + s_ordersSuppressed + s_ordersShifted;
+        int keptPercent = 0;
+        if (total > 0)
+            keptPercent = Math.Round(100.0 * (s_ordersSuppressed + s_ordersShifted) / total);
+        return string.Format("Orders  applied %1  suppressed %2  shifted %3  kept %4%", s_ordersApplied, s_ordersSuppressed, s_ordersShifted, keptPercent);
+    }
+
     // Add a public ApplyTacticalStateOrders method to reapply orders based on current state
     void ApplyTacticalStateOrders()
     {
@@ -3617,6 +3981,24 @@ class IA_AiGroup
     {
         m_isInDefendMode = enable;
         m_defendTarget = defendPoint;
+
+        // No units to order while virtualized (or rematerializing); the record carries the
+        // state and FinishRematerialize issues the defend orders.
+        if (m_virtualRecord)
+        {
+            if (enable && defendPoint != vector.Zero)
+            {
+                m_virtualRecord.m_state = IA_GroupTacticalState.Attacking;
+                m_virtualRecord.m_stateTarget = defendPoint;
+                m_virtualRecord.m_stateFromAuthority = true;
+            }
+            else if (!enable && m_virtualRecord.m_state == IA_GroupTacticalState.Attacking)
+            {
+                m_virtualRecord.m_state = IA_GroupTacticalState.DefendPatrol;
+                m_virtualRecord.m_stateTarget = m_virtualRecord.m_position;
+            }
+            return;
+        }
         
         if (enable && defendPoint != vector.Zero)
         {
@@ -3651,6 +4033,7 @@ class IA_AiGroup
     void SetDefendWaveGroup(bool isWaveGroup)
     {
         m_isDefendWaveGroup = isWaveGroup;
+        RefreshAliveCount();
     }
 
     bool IsDefendWaveGroup()
@@ -3658,6 +4041,21 @@ class IA_AiGroup
         return m_isDefendWaveGroup;
     }
 
+    void SetSpawnPriority(IA_SpawnPriority priority)
+    {
+        m_spawnPriority = priority;
+    }
+
+    //! HVT and defend-wave groups outrank whatever they were created with.
+    IA_SpawnPriority GetSpawnPriority()
+    {
+        if (m_HVTGroup)
+            return IA_SpawnPriority.HVT;
+        if (m_isDefendWaveGroup || m_isInDefendMode)
+            return IA_SpawnPriority.DefendWave;
+        return m_spawnPriority;
+    }
+
     void EnableInboundSimulation(vector target)
     {
         m_bInboundSimPinned = true;
@@ -3766,71 +4164,60 @@ class IA_AiGroup
     
     //------------------------------------------------------------------------------------------------
     
-    // Method to spawn the next unit in the staggered spawning process
-    void SpawnNextUnit()
+    // Queues the staggered spawn set up by the Create* factories; IA_SpawnQueue
+    // then calls SpawnNextUnit / SpawnNextHostileCivilianUnit once per slot.
+    void BeginStaggeredSpawn(bool hostileCivilians = false)
+    {
+        IA_GroupUnitsSpawnRequest request = new IA_GroupUnitsSpawnRequest(this, hostileCivilians);
+        m_unitsSpawnRequest = request;
+        IA_SpawnQueue.Get().Enqueue(request);
+    }
+
+    // Request still streaming this group's characters, or null. Subscribe to its
+    // GetOnComplete() to hear when the last one is in.
+    IA_SpawnRequest GetUnitsSpawnRequest()
     {
-        if (m_pendingUnitsToSpawn <= 0)
+        return m_unitsSpawnRequest;
+    }
+
+    int GetSpawnedUnitCount()
+    {
+        return m_unitsSpawnedCount;
+    }
+
+    // Spawns the next unit of the staggered spawning process. Returns true once
+    // nothing is left to spawn and the group has been handed to OnStaggeredSpawningComplete.
+    bool SpawnNextUnit()
+    {
+        if (m_pendingUnitsToSpawn <= 0 || !m_group)
         {
-            // All units spawned, finalize the group
+            // All units spawned (or the group went away), finalize the group
+            m_pendingUnitsToSpawn = 0;
             OnStaggeredSpawningComplete();
-            return;
+            return true;
         }
-        
-        // Get the prefab path for this unit
+
+        m_pendingUnitsToSpawn--;
+
+        // Get the prefab path for this unit; a failed lookup, load or spawn just skips the unit
         string charPrefabPath = GetRandomUnitPrefab(m_staggeredSpawnFaction, m_staggeredAreaFaction);
-        if (charPrefabPath == "")
-        {
-            // Failed to get prefab, try next unit
-            m_pendingUnitsToSpawn--;
-            if (m_pendingUnitsToSpawn > 0)
-            {
-                GetGame().GetCallqueue().CallLater(this.SpawnNextUnit, 100, false);
-            }
-            else
-            {
-                OnStaggeredSpawningComplete();
-            }
-            return;
-        }
-        
+        Resource charRes;
+        if (charPrefabPath != "")
+            charRes = IA_PrefabCache.Load(charPrefabPath);
+        if (!charRes)
+            return EndStaggeredSpawnStep();
+
         // Generate spawn position
         vector unitSpawnPos = m_staggeredSpawnPos;
         if (!m_HVTGroup)
         {
             unitSpawnPos = m_staggeredSpawnPos + IA_Game.rng.GenerateRandomPointInRadius(1, 3, vector.Zero);
         }
-        Resource charRes = Resource.Load(charPrefabPath);
-        if (!charRes)
-        {
-            // Failed to load resource, try next unit
-            m_pendingUnitsToSpawn--;
-            if (m_pendingUnitsToSpawn > 0)
-            {
-                GetGame().GetCallqueue().CallLater(this.SpawnNextUnit, 100, false);
-            }
-            else
-            {
-                OnStaggeredSpawningComplete();
-            }
-            return;
-        }
-        
+
         IEntity charEntity = GetGame().SpawnEntityPrefab(charRes, null, IA_CreateSimpleSpawnParams(unitSpawnPos));
         if (!charEntity)
-        {
-            // Failed to spawn entity, try next unit
-            m_pendingUnitsToSpawn--;
-            if (m_pendingUnitsToSpawn > 0)
-            {
-                GetGame().GetCallqueue().CallLater(this.SpawnNextUnit, 100, false);
-            }
-            else
-            {
-                OnStaggeredSpawningComplete();
-            }
-            return;
-        }
-        
+            return EndStaggeredSpawnStep();
+
         if (!m_group.AddAIEntityToGroup(charEntity))
         {
             GetGame().GetCallqueue().CallLater(this.RetryAddSpawnedUnit, 150, false, charEntity);
@@ -3841,17 +4228,17 @@ class IA_AiGroup
             m_unitsSpawnedCount++;
             PinInboundAgents();
         }
-        
-        // Decrement pending count and schedule next spawn
-        m_pendingUnitsToSpawn--;
+
+        return EndStaggeredSpawnStep();
+    }
+
+    private bool EndStaggeredSpawnStep()
+    {
         if (m_pendingUnitsToSpawn > 0)
-        {
-            GetGame().GetCallqueue().CallLater(this.SpawnNextUnit, 100, false);
-        }
-        else
-        {
-            OnStaggeredSpawningComplete();
-        }
+            return false;
+
+        OnStaggeredSpawningComplete();
+        return true;
     }
     
     // Called when all units have been spawned (or attempted)
@@ -3898,7 +4285,7 @@ class IA_AiGroup
             if (m_group)
             {
                 IA_Game.AddEntityToGc(m_group);
-                m_group = null;
+                BindGroupEntity(null);
             }
 
             m_isSpawned = true;
@@ -3906,6 +4293,15 @@ class IA_AiGroup
             m_staggeredSpawnPos = vector.Zero;
             m_staggeredSpawnFaction = IA_Faction.NONE;
             m_staggeredAreaFaction = null;
+            m_virtualRecord = null;
+            RefreshAliveCount();
+            m_isRematerializing = false;
+            return;
+        }
+
+        if (m_isRematerializing)
+        {
+            FinishRematerialize();
             return;
         }
 
@@ -3992,67 +4388,33 @@ class IA_AiGroup
 
     //------------------------------------------------------------------------------------------------
     
-    // Method to spawn the next hostile civilian unit in the staggered spawning process
-    void SpawnNextHostileCivilianUnit()
+    // Hostile civilian counterpart of SpawnNextUnit: civilian prefabs, failed adds are discarded.
+    bool SpawnNextHostileCivilianUnit()
     {
-        if (m_pendingUnitsToSpawn <= 0)
+        if (m_pendingUnitsToSpawn <= 0 || !m_group)
         {
             // All units spawned, finalize the group
+            m_pendingUnitsToSpawn = 0;
             OnStaggeredSpawningComplete();
-            return;
+            return true;
         }
-        
+
+        m_pendingUnitsToSpawn--;
+
         // Get civilian prefab path
         string charPrefabPath = IA_RandomCivilianResourceName();
-        if (charPrefabPath == "")
-        {
-            // Failed to get prefab, try next unit
-            m_pendingUnitsToSpawn--;
-            if (m_pendingUnitsToSpawn > 0)
-            {
-                GetGame().GetCallqueue().CallLater(SpawnNextHostileCivilianUnit, 100, false);
-            }
-            else
-            {
-                OnStaggeredSpawningComplete();
-            }
-            return;
-        }
-        
+        Resource charRes;
+        if (charPrefabPath != "")
+            charRes = IA_PrefabCache.Load(charPrefabPath);
+        if (!charRes)
+            return EndStaggeredSpawnStep();
+
         // Generate spawn position
         vector unitSpawnPos = m_staggeredSpawnPos + IA_Game.rng.GenerateRandomPointInRadius(1, 3, vector.Zero);
-        Resource charRes = Resource.Load(charPrefabPath);
-        if (!charRes)
-        {
-            // Failed to load resource, try next unit
-            m_pendingUnitsToSpawn--;
-            if (m_pendingUnitsToSpawn > 0)
-            {
-                GetGame().GetCallqueue().CallLater(SpawnNextHostileCivilianUnit, 100, false);
-            }
-            else
-            {
-                OnStaggeredSpawningComplete();
-            }
-            return;
-        }
-        
         IEntity charEntity = GetGame().SpawnEntityPrefab(charRes, null, IA_CreateSimpleSpawnParams(unitSpawnPos));
         if (!charEntity)
-        {
-            // Failed to spawn entity, try next unit
-            m_pendingUnitsToSpawn--;
-            if (m_pendingUnitsToSpawn > 0)
-            {
-                GetGame().GetCallqueue().CallLater(SpawnNextHostileCivilianUnit, 100, false);
-            }
-            else
-            {
-                OnStaggeredSpawningComplete();
-            }
-            return;
-        }
-        
+            return EndStaggeredSpawnStep();
+
         // Add to group
         if (!m_group.AddAIEntityToGroup(charEntity))
         {
@@ -4064,17 +4426,8 @@ class IA_AiGroup
             m_unitsSpawnedCount++;
             PinInboundAgents();
         }
-        
-        // Decrement pending count and schedule next spawn
-        m_pendingUnitsToSpawn--;
-        if (m_pendingUnitsToSpawn > 0)
-        {
-            GetGame().GetCallqueue().CallLater(SpawnNextHostileCivilianUnit, 100, false);
-        }
-        else
-        {
-            OnStaggeredSpawningComplete();
-        }
+
+        return EndStaggeredSpawnStep();
     }
 
     //------------------------------------------------------------------------------------------------
@@ -4167,32 +4520,11 @@ class IA_AiGroup
         Print(string.Format("[IA_AiGroup.TryFindAndSetAssignedArea] Group %1 at %2 attempting to find its area (m_lastAssignedArea is currently NULL).", 
             this, m_initialPosition.ToString()), LogLevel.NORMAL);
 
-        IA_AreaMarker foundMarker = null;
-        array<IA_AreaMarker> allMarkers = IA_AreaMarker.GetAllMarkers();
-        int markersSearchedCount = 0;
-        
-        if (allMarkers)
-            markersSearchedCount = allMarkers.Count();
-        else 
-            markersSearchedCount = -1; // Indicate null array if that happens
-
-        if (allMarkers && !allMarkers.IsEmpty())
-        {
-            Print(string.Format("[IA_AiGroup.TryFindAndSetAssignedArea] Group %1: Found %2 total area markers to check.", this, markersSearchedCount), LogLevel.NORMAL);
-            foreach (IA_AreaMarker marker : allMarkers)
-            {
-                if (marker && marker.IsPositionInside(m_initialPosition))
-                {
-                    foundMarker = marker;
-                    Print(string.Format("[IA_AiGroup.TryFindAndSetAssignedArea] Group %1 at %2 found to be INSIDE marker %3 (Center: %4, Radius: %5)",
-                        this, m_initialPosition.ToString(), marker.ToString(), marker.GetOrigin().ToString(), marker.GetRadius()), LogLevel.NORMAL);
-                    break;
-                }
-            }
-        }
-        else
+        IA_AreaMarker foundMarker = IA_AreaMarkerIndex.FindContaining(m_initialPosition);
+        if (foundMarker)
         {
-             Print(string.Format("[IA_AiGroup.TryFindAndSetAssignedArea] Group %1: IA_AreaMarker.GetAllMarkers() returned null or empty array. Count: %2", this, markersSearchedCount), LogLevel.WARNING);
+            Print(string.Format("[IA_AiGroup.TryFindAndSetAssignedArea] Group %1 at %2 found to be INSIDE marker %3 (Center: %4, Radius: %5)",
+                this, m_initialPosition.ToString(), foundMarker.ToString(), foundMarker.GetOrigin().ToString(), foundMarker.GetRadius()), LogLevel.NORMAL);
         }
 
         if (foundMarker)
@@ -4322,7 +4654,7 @@ class IA_AiGroup
         IA_AiGroup grp = new IA_AiGroup(spawnPos, IA_SquadType.Riflemen, IA_Faction.USSR, unitCount);
         grp.m_isCivilian = false; // Treat them as combatants
     
-        Resource groupRes = Resource.Load("{8DE0C0830FE0C33D}Prefabs/Groups/OPFOR/Group_USSR_Base.et"); // USSR Group Prefab
+        Resource groupRes = IA_PrefabCache.Load(IA_PrefabCache.GROUP_USSR_BASE); // USSR Group Prefab
     
         if (!groupRes) {
             Print("[IA_AiGroup.CreateHostileCivilianGroup] Failed to load group resource for USSR.", LogLevel.ERROR);
@@ -4330,7 +4662,7 @@ class IA_AiGroup
         }
     
         IEntity groupEnt = GetGame().SpawnEntityPrefab(groupRes, null, IA_CreateSimpleSpawnParams(spawnPos));
-        grp.m_group = SCR_AIGroup.Cast(groupEnt);
+        grp.BindGroupEntity(SCR_AIGroup.Cast(groupEnt));
     
         if (!grp.m_group) {
             delete groupEnt;
@@ -4357,8 +4689,8 @@ class IA_AiGroup
         
         Print(string.Format("[IA_AiGroup.CreateHostileCivilianGroup] Starting staggered spawning of %1 hostile civilians at %2", unitCount, spawnPos.ToString()), LogLevel.NORMAL);
         
-        // Start spawning the first unit immediately
-        grp.SpawnNextHostileCivilianUnit();
+        grp.m_spawnPriority = IA_SpawnPriority.Reinforcement;
+        grp.BeginStaggeredSpawn(true);
     
         return grp;
     }
@@ -4700,24 +5032,27 @@ class IA_AiGroup
 
         if (m_artilleryFireWaypoint)
         {
-            IA_Game.AddEntityToGc(m_artilleryFireWaypoint);
+            // Still on the group: RemoveAllOrders below parks it. Otherwise it finished; park it now.
+            array<AIWaypoint> currentWaypoints = {};
+            m_group.GetWaypoints(currentWaypoints);
+            AIWaypoint oldFireWaypoint = AIWaypoint.Cast(m_artilleryFireWaypoint);
+            if (!currentWaypoints.Contains(oldFireWaypoint))
+                IA_WaypointPool.Release(oldFireWaypoint);
             m_artilleryFireWaypoint = null;
         }
 
         ResourceName wpRes = "{A8F31D47C9E02B16}Prefabs/AI/Waypoints/IA_AIWaypoint_ArtillerySupport.et";
-        Resource res = Resource.Load(wpRes);
-        if (!res)
+        SCR_AIWaypoint wpEnt = IA_WaypointPool.Acquire(wpRes, targetPos);
+        if (!wpEnt)
         {
             Print("[IA_AiGroup] Failed to load IA artillery support waypoint prefab", LogLevel.ERROR);
             return false;
         }
 
-        IEntity wpEnt = GetGame().SpawnEntityPrefab(res, null, IA_CreateSimpleSpawnParams(targetPos));
         SCR_AIWaypointArtillerySupport wp = SCR_AIWaypointArtillerySupport.Cast(wpEnt);
         if (!wp)
         {
-            if (wpEnt)
-                IA_Game.AddEntityToGc(wpEnt);
+            IA_WaypointPool.Release(wpEnt);
             Print("[IA_AiGroup] Failed to cast artillery support waypoint", LogLevel.ERROR);
             return false;
         }
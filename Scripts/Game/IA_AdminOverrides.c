@@ -172,39 +172,27 @@ class IA_AdminOverrides
 	//------------------------------------------------------------------------------------------------
 	protected string ToJson()
 	{
-		int heliI = 0;
-		if (m_bDisableHQHelipads)
-			heliI = 1;
-		int groundI = 0;
-		if (m_bDisableHQGroundVehicles)
-			groundI = 1;
-		int civI = 0;
-		if (m_bEnableCivilianSpawning)
-			civI = 1;
-		int rolesI = 0;
-		if (m_bEnforceRoleRestrictions)
-			rolesI = 1;
-
-		string json = "{";
-		json = json + "\"v\":1";
-		json = json + ",\"civCount\":" + m_fCivilianCountMultiplier.ToString();
-		json = json + ",\"aiScale\":" + m_fAIScaleMultiplier.ToString();
-		json = json + ",\"disableHeli\":" + heliI.ToString();
-		json = json + ",\"disableGround\":" + groundI.ToString();
-		json = json + ",\"artyCooldown\":" + m_iArtilleryCooldown.ToString();
-		json = json + ",\"staticAi\":" + m_fStaticAIScaleOverride.ToString();
-		json = json + ",\"milVeh\":" + m_fMilitaryVehicleCountMultiplier.ToString();
-		json = json + ",\"civVeh\":" + m_fCivilianVehicleCountMultiplier.ToString();
-		json = json + ",\"revolt\":" + m_fCivilianRevoltThreshold.ToString();
-		json = json + ",\"enableCiv\":" + civI.ToString();
-		json = json + ",\"enforceRoles\":" + rolesI.ToString();
-		json = json + ",\"artyChance\":" + m_fArtilleryStrikeChance.ToString();
-		json = json + ",\"artyMin\":" + m_iArtilleryMinDelay.ToString();
-		json = json + ",\"artyMax\":" + m_iArtilleryMaxDelay.ToString();
-		json = json + ",\"haloMax\":" + m_iHaloJumpMaxPlayers.ToString();
-		json = json + ",\"faction\":\"" + m_sEnemyFactionKey + "\"";
-		json = json + "}";
-		return json;
+		IA_JsonWriter writer = new IA_JsonWriter();
+		writer.BeginObject();
+		writer.WriteInt("v", 1);
+		writer.WriteFloat("civCount", m_fCivilianCountMultiplier);
+		writer.WriteFloat("aiScale", m_fAIScaleMultiplier);
+		writer.WriteBool("disableHeli", m_bDisableHQHelipads);
+		writer.WriteBool("disableGround", m_bDisableHQGroundVehicles);
+		writer.WriteInt("artyCooldown", m_iArtilleryCooldown);
+		writer.WriteFloat("staticAi", m_fStaticAIScaleOverride);
+		writer.WriteFloat("milVeh", m_fMilitaryVehicleCountMultiplier);
+		writer.WriteFloat("civVeh", m_fCivilianVehicleCountMultiplier);
+		writer.WriteFloat("revolt", m_fCivilianRevoltThreshold);
+		writer.WriteBool("enableCiv", m_bEnableCivilianSpawning);
+		writer.WriteBool("enforceRoles", m_bEnforceRoleRestrictions);
+		writer.WriteFloat("artyChance", m_fArtilleryStrikeChance);
+		writer.WriteInt("artyMin", m_iArtilleryMinDelay);
+		writer.WriteInt("artyMax", m_iArtilleryMaxDelay);
+		writer.WriteInt("haloMax", m_iHaloJumpMaxPlayers);
+		writer.WriteString("faction", m_sEnemyFactionKey);
+		writer.EndObject();
+		return writer.ToString();
 	}
 
 	//------------------------------------------------------------------------------------------------
@@ -2,7 +2,14 @@
 
 class IA_ApiRequest
 {
-    string ToJson();
+    void WriteJson(IA_JsonWriter writer);
+
+    string ToJson()
+    {
+        IA_JsonWriter writer = new IA_JsonWriter();
+        WriteJson(writer);
+        return writer.ToString();
+    }
 }
 
 class IA_ApiRegisterServerRequest : IA_ApiRequest
@@ -16,18 +23,21 @@ class IA_ApiRegisterServerRequest : IA_ApiRequest
         ownerEmail = email;
     }
 
-    override string ToJson()
+    override void WriteJson(IA_JsonWriter writer)
     {
-        string json = "{";
-        json = json + "\"serverName\": \"" + IA_JsonEscape(serverName) + "\",";
-        json = json + "\"ownerEmail\": \"" + IA_JsonEscape(ownerEmail) + "\"";
-        json = json + "}";
-        return json;
+        writer.BeginObject();
+        writer.WriteString("serverName", serverName);
+        writer.WriteString("ownerEmail", ownerEmail);
+        writer.EndObject();
     }
 }
 
 class IA_ApiSubmitStatsRequest : IA_ApiRequest
 {
+    // matchData format. 1 was one event object per kill/death/capture; 2 is one
+    // PlayerAggregate object per player per batch window (see API_DOCUMENTATION.md).
+    static const int STATS_VERSION = 2;
+
     string serverGuid;
 	string serverName;
     string matchData; 
@@ -39,15 +49,15 @@ class IA_ApiSubmitStatsRequest : IA_ApiRequest
         matchData = data;
     }
 
-    override string ToJson()
+    override void WriteJson(IA_JsonWriter writer)
     {
-        // matchData is already a JSON string, so we don't wrap it in extra quotes.
-        string json = "{";
-        json = json + "\"serverGuid\": \"" + IA_JsonEscape(serverGuid) + "\",";
-		json = json + "\"serverName\": \"" + IA_JsonEscape(serverName) + "\",";
-        json = json + "\"matchData\": " + matchData;
-        json = json + "}";
-        return json;
+        // matchData is already a JSON string, so it goes in raw.
+        writer.BeginObject();
+        writer.WriteString("serverGuid", serverGuid);
+        writer.WriteString("serverName", serverName);
+        writer.WriteInt("statsVersion", STATS_VERSION);
+        writer.WriteRaw("matchData", matchData);
+        writer.EndObject();
     }
 }
 
@@ -187,6 +197,7 @@ class IA_ApiHandler
     void OnSubmitStatsSuccess(RestCallback cb)
     {
         Print("IA API: Statistics submitted successfully.", LogLevel.NORMAL);
+        IA_StatsManager.GetInstance().OnBatchDelivered();
         GetGame().GetCallqueue().CallLater(FetchAllLeaderboards, 5000, false);
     }
 
@@ -196,6 +207,8 @@ class IA_ApiHandler
             Print("IA API: Statistics submission request timed out.", LogLevel.ERROR);
         else
             Print("IA API: Statistics submission failed with error code: " + cb.GetHttpCode(), LogLevel.ERROR);
+
+        IA_StatsManager.GetInstance().OnBatchFailed();
     }
 
     void OnFetchAllLeaderboardsSuccess(RestCallback cb)
@@ -228,12 +241,18 @@ class IA_ApiHandler
             Print("IA API: All leaderboards request FAILED with error code: " + cb.GetHttpCode(), LogLevel.ERROR);
     }
 
-    void SubmitStats(string jsonData)
+    bool HasServerGuid()
     {
-        if (!m_Config || m_Config.m_sServerGuid == "")
+        return m_Config && m_Config.m_sServerGuid != "";
+    }
+
+    // Returns false if nothing was sent; otherwise the result arrives via IA_StatsManager.OnBatchDelivered/OnBatchFailed.
+    bool SubmitStats(string jsonData)
+    {
+        if (!HasServerGuid())
         {
             Print("IA API: Cannot submit stats, server GUID is missing.", LogLevel.ERROR);
-            return;
+            return false;
         }
 
         RestContext ctx = GetGame().GetRestApi().GetContext(m_sApiBaseUrl);
@@ -246,8 +265,10 @@ class IA_ApiHandler
         m_submitStatsCallback = new RestCallback();
         m_submitStatsCallback.SetOnSuccess(OnSubmitStatsSuccess);
         m_submitStatsCallback.SetOnError(OnSubmitStatsError);
-        ctx.POST(m_submitStatsCallback, "/submitStats", requestData.ToJson());
-        Print("IA API: Submitting statistics for server: " + serverName + " with payload: " + requestData.ToJson(), LogLevel.NORMAL);
+        string requestJson = requestData.ToJson();
+        ctx.POST(m_submitStatsCallback, "/submitStats", requestJson);
+        Print("IA API: Submitting statistics for server: " + serverName + " with payload: " + requestJson, LogLevel.NORMAL);
+        return true;
     }
 
     void FetchAllLeaderboards()
@@ -37,6 +37,8 @@ class IA_AreaGroupManager
     // Single cooldown and chance for the whole QRF system
     private const int QRF_COOLDOWN = 120; // seconds
     private const float QRF_CHANCE = 0.2;
+    // Danger positions fed to the threat median; more are reservoir-sampled down to this
+    private const int THREAT_SAMPLE_CAP = 64;
     private int m_lastQRFTime = 0;
     private bool m_qrfRetryPending = false;
     private IA_QRFType m_qrfRetryType;
@@ -53,12 +55,14 @@ class IA_AreaGroupManager
         int currentTime = System.GetUnixTime();
         if (IA_MissionInitializer.IsQRFDisabled())
             return; // QRF globally disabled
-        Print(string.Format("[QRF] Running for group with %1 areas.", m_areaInstances.Count()), LogLevel.NORMAL);
+        if (IA_Log.Allow(IA_LogCategory.QRF, "QRF.Run", 60000))
+            IA_Log.Write(IA_LogCategory.QRF, string.Format("Running for group with %1 areas.", m_areaInstances.Count()));
 
         // 1) Check interval
         if (currentTime - m_lastQRFCheckTime < QRF_CHECK_INTERVAL)
         {
-            Print(string.Format("[QRF] Check skipped: interval not yet met. %1s remaining.", QRF_CHECK_INTERVAL - (currentTime - m_lastQRFCheckTime)), LogLevel.NORMAL);
+            if (IA_Log.Allow(IA_LogCategory.QRF, "QRF.Interval", 60000))
+                IA_Log.Write(IA_LogCategory.QRF, string.Format("Check skipped: interval not yet met. %1s remaining.", QRF_CHECK_INTERVAL - (currentTime - m_lastQRFCheckTime)));
             return;
         }
         m_lastQRFCheckTime = currentTime;
@@ -75,7 +79,8 @@ class IA_AreaGroupManager
         }
         if (!groupUnderAttack)
         {
-            Print("[QRF] Check failed: No area in the group is under attack.", LogLevel.NORMAL);
+            if (IA_Log.Allow(IA_LogCategory.QRF, "QRF.NotUnderAttack", 60000))
+                IA_Log.Write(IA_LogCategory.QRF, "Check failed: No area in the group is under attack.");
             return;
         }
 
@@ -84,7 +89,8 @@ class IA_AreaGroupManager
         bool hasTarget = ComputeGroupThreatTarget(targetPos);
         if (!hasTarget || targetPos == vector.Zero)
         {
-            Print("[QRF] Aborted: No valid recent danger events to target.", LogLevel.NORMAL);
+            if (IA_Log.Allow(IA_LogCategory.QRF, "QRF.NoTarget", 60000))
+                IA_Log.Write(IA_LogCategory.QRF, "Aborted: No valid recent danger events to target.");
             return;
         }
 
@@ -92,14 +98,16 @@ class IA_AreaGroupManager
         if (currentTime - m_lastQRFTime < QRF_COOLDOWN)
         {
             int remaining = QRF_COOLDOWN - (currentTime - m_lastQRFTime);
-            Print(string.Format("[QRF] Global cooldown active: %1s remaining.", remaining), LogLevel.NORMAL);
+            if (IA_Log.Allow(IA_LogCategory.QRF, "QRF.Cooldown", 60000))
+                IA_Log.Write(IA_LogCategory.QRF, string.Format("Global cooldown active: %1s remaining.", remaining));
             return;
         }
 
         float roll = IA_Game.rng.RandFloat01();
         if (roll > QRF_CHANCE)
         {
-            Print(string.Format("[QRF] Global chance failed (roll %1 > %2).", roll, QRF_CHANCE), LogLevel.NORMAL);
+            if (IA_Log.IsOn(IA_LogCategory.QRF))
+                IA_Log.Write(IA_LogCategory.QRF, string.Format("Global chance failed (roll %1 > %2).", roll, QRF_CHANCE));
             return;
         }
 
@@ -125,8 +133,9 @@ class IA_AreaGroupManager
             return;
         }
 
-        Print(string.Format("[QRF] Selected %1; closest area '%2'; final target %3. Attempting spawn...",
-            QRFTypeToString(selectedType), closestArea.GetArea().GetName(), finalTarget.ToString()), LogLevel.NORMAL);
+        if (IA_Log.IsOn(IA_LogCategory.QRF))
+            IA_Log.Write(IA_LogCategory.QRF, string.Format("Selected %1; closest area '%2'; final target %3. Attempting spawn...",
+                QRFTypeToString(selectedType), closestArea.GetArea().GetName(), finalTarget.ToString()));
 
         bool spawned = SpawnQRFForTarget(selectedType, finalTarget, closestArea, null, false, false);
         if (spawned)
@@ -177,8 +186,9 @@ class IA_AreaGroupManager
         else
             type = IA_QRFType.Armoured;
 
-        Print(string.Format("[QRF] Defend vehicle beat selected %1 toward %2",
-            QRFTypeToString(type), defendPoint.ToString()), LogLevel.NORMAL);
+        if (IA_Log.IsOn(IA_LogCategory.QRF))
+            IA_Log.Write(IA_LogCategory.QRF, string.Format("Defend vehicle beat selected %1 toward %2",
+                QRFTypeToString(type), defendPoint.ToString()));
 
         return SpawnQRFForTarget(type, defendPoint, areaInst, enemyFaction, true, false);
     }
@@ -187,7 +197,6 @@ class IA_AreaGroupManager
     private bool ComputeGroupThreatTarget(out vector outTarget)
     {
         outTarget = vector.Zero;
-        int currentTime = System.GetUnixTime();
 
         // Calculate group center for distance clamping
         vector groupCenter = vector.Zero;
@@ -207,7 +216,8 @@ class IA_AreaGroupManager
         if (count > 0)
         {
             groupCenter = totalPos / count;
-            Print(string.Format("[QRF] Calculated area group center: %1", groupCenter), LogLevel.NORMAL);
+            if (IA_Log.Allow(IA_LogCategory.QRF, "Threat.Center", 60000))
+                IA_Log.Write(IA_LogCategory.QRF, string.Format("Calculated area group center: %1", groupCenter));
         }
         else
         {
@@ -215,8 +225,42 @@ class IA_AreaGroupManager
             return false;
         }
 
-        array<vector> relevantPositions = {};
         const float MAX_DANGER_EVENT_DISTANCE = 1600.0;
+        vector primaryThreatLocation;
+        IA_ThreatMap threatMap = IA_ThreatMap.GetIfCovers(groupCenter, MAX_DANGER_EVENT_DISTANCE);
+        if (threatMap)
+        {
+            // Hottest block of the shared threat map: the main fight, not stray contacts
+            float heat;
+            primaryThreatLocation = threatMap.GetHotspot(groupCenter, MAX_DANGER_EVENT_DISTANCE, heat);
+            if (heat <= 0)
+            {
+                if (IA_Log.Allow(IA_LogCategory.QRF, "Threat.None", 60000))
+                    IA_Log.Write(IA_LogCategory.QRF, "No recent danger on the threat map around the area group.");
+                return false;
+            }
+        }
+        else if (!SampleGroupThreatMedian(groupCenter, MAX_DANGER_EVENT_DISTANCE, primaryThreatLocation))
+        {
+            return false;
+        }
+
+        // Apply small randomization like artillery
+        outTarget = IA_Game.rng.GenerateRandomPointInRadius(4, 30, primaryThreatLocation);
+        outTarget[1] = GetGame().GetWorld().GetSurfaceY(outTarget[0], outTarget[2]);
+        if (IA_Log.IsOn(IA_LogCategory.QRF))
+            IA_Log.Write(IA_LogCategory.QRF, string.Format("Target determined (Hotspot/median+jitter): %1 for area group.", outTarget));
+        return true;
+    }
+
+    // Fallback when the threat map doesn't cover the group: geometric median of the recent
+    // danger positions every military group logged, reservoir-sampled down to THREAT_SAMPLE_CAP.
+    private bool SampleGroupThreatMedian(vector groupCenter, float maxDistance, out vector outThreat)
+    {
+        outThreat = vector.Zero;
+        int currentTime = System.GetUnixTime();
+        IA_VectorReservoir relevantPositions = new IA_VectorReservoir(THREAT_SAMPLE_CAP);
+        array<vector> groupPositions = {};
 
         foreach (IA_AreaInstance instance : m_areaInstances)
         {
@@ -228,35 +272,40 @@ class IA_AreaGroupManager
                 int timeSinceLastDanger = currentTime - group.GetLastDangerEventTime();
                 if (group && group.GetLastDangerEventTime() > 0 && timeSinceLastDanger < 90)
                 {
-                    vector currentDangerPos = group.GetLastDangerPosition();
-                    if (currentDangerPos != vector.Zero)
+                    // Every recent shot the group logged, not just its summary position
+                    groupPositions.Clear();
+                    if (group.GetRecentDangerPositions(groupPositions) == 0)
+                    {
+                        vector lastDangerPos = group.GetLastDangerPosition();
+                        if (lastDangerPos != vector.Zero)
+                            groupPositions.Insert(lastDangerPos);
+                    }
+
+                    foreach (vector currentDangerPos : groupPositions)
                     {
-                        if (vector.DistanceSq(currentDangerPos, groupCenter) <= (MAX_DANGER_EVENT_DISTANCE * MAX_DANGER_EVENT_DISTANCE))
+                        if (vector.DistanceSq(currentDangerPos, groupCenter) <= (maxDistance * maxDistance))
                         {
-                            relevantPositions.Insert(currentDangerPos);
+                            relevantPositions.Offer(currentDangerPos);
                         }
                         else
                         {
-                            Print(string.Format("[QRF] Discarded danger event at %1, too far from group center %2 (Distance: %3m, Max: %4m)", currentDangerPos, groupCenter, vector.Distance(currentDangerPos, groupCenter), MAX_DANGER_EVENT_DISTANCE), LogLevel.NORMAL);
+                            if (IA_Log.Allow(IA_LogCategory.QRF, "Threat.Discarded", 10000))
+                                IA_Log.Write(IA_LogCategory.QRF, string.Format("Discarded danger event at %1, too far from group center %2 (Distance: %3m, Max: %4m)", currentDangerPos, groupCenter, vector.Distance(currentDangerPos, groupCenter), maxDistance));
                         }
                     }
                 }
             }
         }
 
-        if (relevantPositions.IsEmpty())
+        array<vector> samples = relevantPositions.GetSamples();
+        if (samples.IsEmpty())
         {
-            Print("[QRF] No recent danger events found across area group.", LogLevel.NORMAL);
+            if (IA_Log.Allow(IA_LogCategory.QRF, "Threat.None", 60000))
+                IA_Log.Write(IA_LogCategory.QRF, "No recent danger events found across area group.");
             return false;
         }
 
-        // Median selection by X as in artillery, then apply small randomization like artillery
-        IA_VectorUtils.SortVectorsByX(relevantPositions);
-        int medianIndex = relevantPositions.Count() / 2;
-        vector primaryThreatLocation = relevantPositions[medianIndex];
-        outTarget = IA_Game.rng.GenerateRandomPointInRadius(4, 30, primaryThreatLocation);
-        outTarget[1] = GetGame().GetWorld().GetSurfaceY(outTarget[0], outTarget[2]);
-        Print(string.Format("[QRF] Target determined (Median+jitter): %1 for area group.", outTarget), LogLevel.NORMAL);
+        outThreat = IA_VectorUtils.GeometricMedianXZ(samples);
         return true;
     }
 
@@ -339,7 +388,7 @@ class IA_AreaGroupManager
                 notif = QRFTypeToString(type) + " counterattack inbound!";
             else
                 notif = QRFTypeToString(type) + " inbound at " + areaName + "!";
-            IA_Game.S_TriggerGlobalNotification("ReinforcementsCalled", notif);
+            IA_Game.S_TriggerGlobalNotification(IA_NotificationType.ReinforcementsCalled, notif);
             Print(string.Format("[QRF] %1 spawned towards %2 at %3 (defendBeat=%4)",
                 QRFTypeToString(type), areaName, targetPos.ToString(), forDefendMission), LogLevel.NORMAL);
         }
@@ -401,19 +450,11 @@ class IA_AreaGroupManager
         if (!grp.HasActiveWaypoint())
         {
             ResourceName sadRes = "{EE9A99488B40628B}PrefabsEditable/Auto/AI/Waypoints/E_AIWaypoint_SearchAndDestroy.et";
-            Resource res = Resource.Load(sadRes);
-            if (res)
+            SCR_AIWaypoint w = IA_WaypointPool.Acquire(sadRes, targetPos);
+            if (w)
             {
-                EntitySpawnParams p = EntitySpawnParams();
-                p.TransformMode = ETransformMode.WORLD;
-                p.Transform[3] = targetPos;
-                IEntity ent = GetGame().SpawnEntityPrefab(res, null, p);
-                SCR_AIWaypoint w = SCR_AIWaypoint.Cast(ent);
-                if (w)
-                {
-                    w.SetPriorityLevel(IA_AiGroup.WP_PRIORITY_FIGHT);
-                    grp.AddWaypoint(w);
-                }
+                w.SetPriorityLevel(IA_AiGroup.WP_PRIORITY_FIGHT);
+                grp.AddWaypoint(w);
             }
         }
         areaInst.AddMilitaryGroup(grp);
@@ -421,9 +462,27 @@ class IA_AreaGroupManager
         grp.EnableInboundSimulation(targetPos);
         // Lock S&D order to this threat for the lifetime of this reinforcement
         IA_LockGroupToSearchAndDestroy(areaInst, grp, targetPos);
+
+        IA_SpawnRequest unitsRequest = grp.GetUnitsSpawnRequest();
+        if (unitsRequest)
+            unitsRequest.GetOnComplete().Insert(OnQRFInfantrySpawned);
         return true;
     }
 
+    // IA_SpawnQueue callback once a QRF squad's characters are in.
+    void OnQRFInfantrySpawned(IA_SpawnRequest request)
+    {
+        IA_AiGroup grp = request.GetGroup();
+        if (!grp || grp.GetSpawnedUnitCount() <= 0)
+        {
+            Print("[QRF] Infantry squad spawned no units; the group is discarded.", LogLevel.WARNING);
+            return;
+        }
+
+        if (IA_Log.IsOn(IA_LogCategory.QRF))
+            IA_Log.Write(IA_LogCategory.QRF, string.Format("Infantry squad is in with %1 units at %2.", grp.GetSpawnedUnitCount(), grp.GetOrigin().ToString()));
+    }
+
     private bool SpawnVehicleQRF(IA_AreaInstance areaInst, Faction enemyGameFaction, vector targetPos, bool preferAPC, bool allowTrucks, bool armourOnly, vector preferredSpawn, bool forDefendMission = false)
     {
         int activeGroup = IA_VehicleManager.GetActiveGroup();
@@ -579,42 +638,7 @@ class IA_AreaGroupManager
     // Determine vehicle class flags from its catalog labels
     private void DetermineVehicleClass(Vehicle vehicle, out bool isTruck, out bool isAPC, out bool isArmored)
     {
-        isTruck = false; isAPC = false; isArmored = false;
-        if (!vehicle) return;
-        SCR_EditableVehicleComponent editableVehicle = SCR_EditableVehicleComponent.Cast(vehicle.FindComponent(SCR_EditableVehicleComponent));
-        if (!editableVehicle) return;
-        string prefabPath = editableVehicle.GetPrefab();
-        if (prefabPath == string.Empty) return;
-
-        SCR_FactionManager factionManager = SCR_FactionManager.Cast(GetGame().GetFactionManager());
-        if (!factionManager) return;
-        array<Faction> allFactions = {};
-        factionManager.GetFactionsList(allFactions);
-
-        array<EEditableEntityLabel> vehicleLabels = {};
-        foreach (Faction f : allFactions)
-        {
-            SCR_Faction scrFaction = SCR_Faction.Cast(f);
-            if (!scrFaction) continue;
-            SCR_EntityCatalog cat = scrFaction.GetFactionEntityCatalogOfType(EEntityCatalogType.VEHICLE, true);
-            if (!cat) continue;
-            SCR_EntityCatalogEntry entry = cat.GetEntryWithPrefab(prefabPath);
-            if (entry)
-            {
-                entry.GetEditableEntityLabels(vehicleLabels);
-                break;
-            }
-        }
-
-        foreach (EEditableEntityLabel label : vehicleLabels)
-        {
-            if (label == EEditableEntityLabel.VEHICLE_TRUCK)
-                isTruck = true;
-            if (label == EEditableEntityLabel.VEHICLE_APC)
-                isAPC = true;
-            if (label == EEditableEntityLabel.TRAIT_ARMOR)
-                isArmored = true;
-        }
+        IA_VehicleManager.GetVehicleClass(vehicle, isTruck, isAPC, isArmored);
     }
 
     // Poller to detect truck arrival at driveTarget, then order dismount and later defend
@@ -671,7 +695,8 @@ class IA_AreaGroupManager
         IA_AreaInstance mortarPit = FindMortarPitInstance();
         if (!mortarPit || !mortarPit.CanIssueMortarFireMission())
         {
-            Print("[ArtilleryStrike] Check failed: No usable mortar pit crew in this AO group.", LogLevel.NORMAL);
+            if (IA_Log.Allow(IA_LogCategory.Artillery, "Arty.NoPit", 60000))
+                IA_Log.Write(IA_LogCategory.Artillery, "Check failed: No usable mortar pit crew in this AO group.");
             return;
         }
 
@@ -685,7 +710,8 @@ class IA_AreaGroupManager
                 if (mortarPit.IssueMortarFireMission(defensePos, defenseShots))
                 {
                     m_lastPitDefenseFireTime = currentTime;
-                    Print(string.Format("[ArtilleryStrike] Pit defense fire: %1 rounds at %2", defenseShots, defensePos), LogLevel.NORMAL);
+                    if (IA_Log.IsOn(IA_LogCategory.Artillery))
+                        IA_Log.Write(IA_LogCategory.Artillery, string.Format("Pit defense fire: %1 rounds at %2", defenseShots, defensePos));
                 }
             }
             return;
@@ -693,7 +719,8 @@ class IA_AreaGroupManager
 
         if (currentTime - m_lastArtilleryStrikeCheckTime < ARTILLERY_CHECK_INTERVAL)
         {
-            Print(string.Format("[ArtilleryStrike] Check skipped: interval not yet met. %1s remaining.", ARTILLERY_CHECK_INTERVAL - (currentTime - m_lastArtilleryStrikeCheckTime)), LogLevel.NORMAL);
+            if (IA_Log.Allow(IA_LogCategory.Artillery, "Arty.Interval", 60000))
+                IA_Log.Write(IA_LogCategory.Artillery, string.Format("Check skipped: interval not yet met. %1s remaining.", ARTILLERY_CHECK_INTERVAL - (currentTime - m_lastArtilleryStrikeCheckTime)));
             return;
         }
         m_lastArtilleryStrikeCheckTime = currentTime;
@@ -711,28 +738,33 @@ class IA_AreaGroupManager
         }
         if (!groupUnderAttack)
         {
-            Print("[ArtilleryStrike] Check failed: No area in the group is under attack.", LogLevel.NORMAL);
+            if (IA_Log.Allow(IA_LogCategory.Artillery, "Arty.NotUnderAttack", 60000))
+                IA_Log.Write(IA_LogCategory.Artillery, "Check failed: No area in the group is under attack.");
             return;
         }
-        Print(string.Format("[ArtilleryStrike] Passed 'Under Attack' check. Area '%1' is under attack.", attackedAreaName), LogLevel.NORMAL);
+        if (IA_Log.Allow(IA_LogCategory.Artillery, "Arty.UnderAttack", 60000))
+            IA_Log.Write(IA_LogCategory.Artillery, string.Format("Passed 'Under Attack' check. Area '%1' is under attack.", attackedAreaName));
 
         if (currentTime - m_lastArtilleryStrikeEndTime < cooldown)
         {
-            Print(string.Format("[ArtilleryStrike] Check failed: On cooldown. %1 seconds remaining.", cooldown - (currentTime - m_lastArtilleryStrikeEndTime)), LogLevel.NORMAL);
+            if (IA_Log.Allow(IA_LogCategory.Artillery, "Arty.Cooldown", 60000))
+                IA_Log.Write(IA_LogCategory.Artillery, string.Format("Check failed: On cooldown. %1 seconds remaining.", cooldown - (currentTime - m_lastArtilleryStrikeEndTime)));
             return;
         }
 
         float randomRoll = IA_Game.rng.RandFloat01();
         if (randomRoll > strikeChance)
         {
-            Print(string.Format("[ArtilleryStrike] Check failed: Random chance not met (Rolled %1, needed <= %2).", randomRoll, strikeChance), LogLevel.NORMAL);
+            if (IA_Log.IsOn(IA_LogCategory.Artillery))
+                IA_Log.Write(IA_LogCategory.Artillery, string.Format("Check failed: Random chance not met (Rolled %1, needed <= %2).", randomRoll, strikeChance));
             return;
         }
 
         vector targetPos;
         if (!ComputeGroupThreatTarget(targetPos))
         {
-            Print("[ArtilleryStrike] Strike aborted for area group. No recent danger events found.", LogLevel.NORMAL);
+            if (IA_Log.IsOn(IA_LogCategory.Artillery))
+                IA_Log.Write(IA_LogCategory.Artillery, "Strike aborted for area group. No recent danger events found.");
             return;
         }
 
@@ -745,7 +777,8 @@ class IA_AreaGroupManager
         }
 
         m_lastArtilleryStrikeEndTime = currentTime;
-        Print(string.Format("[ArtilleryStrike] Fire mission issued: %1 rounds at %2. Cooldown started for %3 seconds.", shotCount, targetPos, cooldown), LogLevel.NORMAL);
+        if (IA_Log.IsOn(IA_LogCategory.Artillery))
+            IA_Log.Write(IA_LogCategory.Artillery, string.Format("Fire mission issued: %1 rounds at %2. Cooldown started for %3 seconds.", shotCount, targetPos, cooldown));
     }
 
     protected IA_AreaInstance FindMortarPitInstance()
@@ -25,13 +25,52 @@ class IA_PendingStateRequest
     IA_GroupTacticalState currentState;
 }
 
-//! Single CallLater payload so reinforcement spawns don't drop AreaFaction / unit count.
-class IA_ReinforcementSpawnRequest
+//! Queued reinforcement squad; carries AreaFaction / unit count through IA_SpawnQueue.
+class IA_ReinforcementSpawnRequest : IA_SpawnRequest
 {
+    IA_AreaInstance m_areaInstance;
     Faction m_areaFaction;
     bool m_forDefendMission;
     int m_sectorIndex;
     int m_unitCountOverride;
+
+    override bool Step()
+    {
+        if (m_areaInstance)
+            m_areaInstance.SpawnReinforcementEnactorFromRequest(this);
+        return true;
+    }
+}
+
+//! Queued garrison / mortar pit group: starts the road search that creates the group.
+class IA_AreaGroupSpawnRequest : IA_SpawnRequest
+{
+    IA_AreaInstance m_areaInstance;
+    vector m_spawnPos;
+    int m_unitCount;
+    Faction m_areaFaction;
+    bool m_useExactPosition;
+
+    override bool Step()
+    {
+        if (m_areaInstance)
+            m_areaInstance.SpawnAreaGroupFromRequest(this);
+        return true;
+    }
+}
+
+//! Queued civilian revolt group.
+class IA_HostileCivilianSpawnRequest : IA_SpawnRequest
+{
+    IA_AreaInstance m_areaInstance;
+    Faction m_areaFaction;
+
+    override bool Step()
+    {
+        if (m_areaInstance)
+            m_areaInstance.SpawnHostileCivilianGroupFromRequest(this);
+        return true;
+    }
 }
 
 class IA_AreaInstance
@@ -40,6 +79,10 @@ class IA_AreaInstance
     IA_Faction m_faction;
     int m_strength;
     private ref array<ref IA_AiGroup> m_military  = {};
+    // Alive units in m_military, pushed by the groups (IA_AiGroup.RefreshAliveCount)
+    private int m_aliveMilitary = 0;
+    private int m_aliveDefendWave = 0;
+    private int m_aliveSpawnedDefendWave = 0;
     private ref array<ref IA_AiGroup> m_civilians = {};
 	private int m_initialCivilianCount = 0;
     private int m_aliveCivilianCount = 0;
@@ -75,9 +118,16 @@ class IA_AreaInstance
 
     private ref IA_AreaAttackers m_aiAttackers = null;
 
+    // Virtualization of far-off infantry groups (see VirtualizationTask)
+    private const float VIRTUALIZE_REMATERIALIZE_MARGIN_M = 300.0;
+    private const int VIRTUALIZE_MAX_PER_TICK = 2;
+    private const int REMATERIALIZE_MAX_PER_TICK = 4;
+
+    // Floor on a group's weight in threat centroids, so a recent report with decayed danger still counts
+    private const float THREAT_MIN_WEIGHT = 0.1;
+
     private IA_ReinforcementState m_reinforcements = IA_ReinforcementState.NotDone;
     private int m_reinforcementTimer = 0;
-    private int m_currentTask = 0;
     private bool m_canSpawn   = true;
     
     // --- BEGIN ADDED: Reinforcement Wave Variables ---
@@ -237,17 +287,13 @@ class IA_AreaInstance
                                     m_assignedGroupStates.Remove(group);
                                 // --- END ADDED ---
                                 group.Despawn();
+                                group.DetachStrengthSink(this);
                             }
                             m_military.Remove(index);
                         }
                         
                         // Update overall strength
-                        int totalStrength = 0;
-                        foreach (IA_AiGroup g : m_military)
-                        {
-                            totalStrength += g.GetAliveCount();
-                        }
-                        OnStrengthChange(totalStrength);
+                        OnStrengthChange(m_aliveMilitary);
                     }
                 }
             }
@@ -332,7 +378,7 @@ class IA_AreaInstance
 			Print(string.Format("[IA_AreaInstance] Completing current task: %1", taskTitle), LogLevel.DEBUG);
 			
 			// Trigger task completion notification
-			TriggerGlobalNotification("TaskCompleted", taskTitle);
+			TriggerGlobalNotification(IA_NotificationType.TaskCompleted, taskTitle);
 			
 			m_currentTaskEntity.SetTaskState(SCR_ETaskState.COMPLETED);
 			m_currentTaskEntity = null;
@@ -347,7 +393,7 @@ class IA_AreaInstance
 					m_currentTaskEntity.SetTaskState(SCR_ETaskState.CREATED);
 					
 					string newTaskTitle = m_currentTaskEntity.GetTaskName();
-					TriggerGlobalNotification("TaskCreated", newTaskTitle);
+					TriggerGlobalNotification(IA_NotificationType.TaskCreated, newTaskTitle);
 				}
 			}
 			return true;
@@ -362,7 +408,7 @@ class IA_AreaInstance
 				Print(string.Format("[IA_AreaInstance] Found and removing queued task: %1", taskTitle), LogLevel.DEBUG);
 				
 				// Trigger task completion notification
-				TriggerGlobalNotification("TaskCompleted", taskTitle);
+				TriggerGlobalNotification(IA_NotificationType.TaskCompleted, taskTitle);
 				
 				// Clean up the task entity and remove from queue
 				IA_Game.AddEntityToGc(queuedTask);
@@ -508,7 +554,7 @@ class IA_AreaInstance
         //////Print("[DEBUG] Task created and activated.", LogLevel.DEBUG);
 		
 		// --- BEGIN ADDED: Notify players of new task ---
-		TriggerGlobalNotification("TaskCreated", title);
+		TriggerGlobalNotification(IA_NotificationType.TaskCreated, title);
 		// --- END ADDED ---
     }
 
@@ -524,7 +570,7 @@ class IA_AreaInstance
 			if (taskState != SCR_ETaskState.COMPLETED)
 			{
 				string completedTaskTitle = m_currentTaskEntity.GetTaskName();
-				TriggerGlobalNotification("TaskCompleted", completedTaskTitle);
+				TriggerGlobalNotification(IA_NotificationType.TaskCompleted, completedTaskTitle);
 				m_currentTaskEntity.SetTaskState(SCR_ETaskState.COMPLETED);
 			}
             m_currentTaskEntity = null;
@@ -537,7 +583,7 @@ class IA_AreaInstance
             {
                 m_currentTaskEntity.SetTaskState(SCR_ETaskState.CREATED);
                 string newTaskTitle = m_currentTaskEntity.GetTaskName();
-                TriggerGlobalNotification("TaskCreated", newTaskTitle);
+                TriggerGlobalNotification(IA_NotificationType.TaskCreated, newTaskTitle);
             }
         }
     }
@@ -550,52 +596,163 @@ class IA_AreaInstance
         }
     }
 
-    void RunNextTask()
+    //! Entry point for IA_TaskScheduler; each task runs on its own period.
+    void RunScheduledTask(IA_ScheduledTask task)
     {
-        m_currentTask = m_currentTask + 1;
-        if (m_currentTask == 1)
-        {
-            // Placeholder cycle
-        }
-        else if (m_currentTask == 2)
-        {
-            ReinforcementsTask();
-        }
-        else if (m_currentTask == 3)
-        {
-            StrengthUpdateTask();
-        }
-        else if (m_currentTask == 4)
-        {
-            VehicleReinforcementsTask();
-        }
-        else if (m_currentTask == 5)
-        {
-            MilitaryOrderTask();
-        }
-        else if (m_currentTask == 6)
+        if (!IA_Profiler.IsEnabled())
         {
-            CivilianOrderTask();
-        }
-        else if (m_currentTask == 7)
-        {
-            AiAttackersTask();
+            DispatchScheduledTask(task);
+            return;
         }
-        else if (m_currentTask == 8)
+
+        int profileStart = IA_Profiler.Begin();
+        DispatchScheduledTask(task);
+
+        string areaName;
+        if (m_area)
+            areaName = m_area.GetName();
+        IA_Profiler.End(GetTaskProfileLabel(task), profileStart, areaName);
+    }
+
+    // Profiler label per IA_ScheduledTask, resolved once rather than on every call.
+    protected static ref array<string> s_aTaskProfileLabels;
+
+    protected static string GetTaskProfileLabel(IA_ScheduledTask task)
+    {
+        if (!s_aTaskProfileLabels)
         {
-            VehicleManagementTask();
+            s_aTaskProfileLabels = {};
+            for (int t = IA_ScheduledTask.GameUpdate; t <= IA_ScheduledTask.AIReactions; t++)
+            {
+                s_aTaskProfileLabels.Insert(typename.EnumToString(IA_ScheduledTask, t));
+            }
         }
-        else if (m_currentTask == 9)
-        {
-            AIReactionsTask();
+        return s_aTaskProfileLabels[task];
+    }
+
+    protected void DispatchScheduledTask(IA_ScheduledTask task)
+    {
+        switch (task)
+        {
+            case IA_ScheduledTask.AreaUpkeep:
+                UpdateTask();
+                VirtualizationTask();
+                SpawnPointPoolTask();
+                RadioTowerDefenseTask();
+                SideObjectiveDefenseTask();
+                break;
+            case IA_ScheduledTask.Reinforcements:
+                ReinforcementsTask();
+                break;
+            case IA_ScheduledTask.StrengthUpdate:
+                StrengthUpdateTask();
+                break;
+            case IA_ScheduledTask.VehicleReinforcements:
+                VehicleReinforcementsTask();
+                break;
+            case IA_ScheduledTask.MilitaryOrders:
+                MilitaryOrderTask();
+                break;
+            case IA_ScheduledTask.CivilianOrders:
+                CivilianOrderTask();
+                break;
+            case IA_ScheduledTask.AiAttackers:
+                AiAttackersTask();
+                break;
+            case IA_ScheduledTask.VehicleManagement:
+                VehicleManagementTask();
+                break;
+            case IA_ScheduledTask.AIReactions:
+                AIReactionsTask();
+                break;
         }
-        else if (m_currentTask == 10)
+    }
+
+    // Collapses quiet infantry groups that no player is near into records, and brings
+    // them back through IA_AiGroup.Spawn once a player closes in. The re-materialize
+    // radius is smaller than the virtualize radius so groups don't flap at the edge.
+    private void VirtualizationTask()
+    {
+        IA_Config config = IA_MissionInitializer.GetGlobalConfig();
+        float virtualizeDistance = 0;
+        if (config)
+            virtualizeDistance = config.m_fAIVirtualizeDistance;
+
+        IA_PlayerSnapshot snapshot = IA_PlayerSnapshot.Get();
+        float virtualizeSq = virtualizeDistance * virtualizeDistance;
+        float wakeDistance = Math.Max(virtualizeDistance - VIRTUALIZE_REMATERIALIZE_MARGIN_M, 0);
+        float wakeSq = wakeDistance * wakeDistance;
+
+        int virtualized = 0;
+        int rematerialized = 0;
+        int stillVirtual = 0;
+        foreach (IA_AiGroup group : m_military)
         {
-            m_currentTask = 0;
+            if (!group)
+                continue;
+
+            if (group.IsVirtualized())
+            {
+                if (group.IsRematerializing())
+                    continue;
+
+                float nearestSq = snapshot.NearestLiveDistanceSqXZ(group.GetOrigin());
+                // Disabled (distance 0) wakes everything.
+                bool wake = virtualizeDistance <= 0 || (nearestSq >= 0 && nearestSq <= wakeSq);
+                if (wake && rematerialized < REMATERIALIZE_MAX_PER_TICK && group.Rematerialize())
+                {
+                    rematerialized++;
+                    continue;
+                }
+                stillVirtual++;
+                continue;
+            }
+
+            if (virtualizeDistance <= 0 || virtualized >= VIRTUALIZE_MAX_PER_TICK)
+                continue;
+            if (!group.CanVirtualize())
+                continue;
+
+            float distSq = snapshot.NearestLiveDistanceSqXZ(group.GetOrigin());
+            if (distSq >= 0 && distSq < virtualizeSq)
+                continue;
+
+            if (group.Virtualize())
+            {
+                virtualized++;
+                stillVirtual++;
+            }
         }
-        UpdateTask();
-        RadioTowerDefenseTask();
-        SideObjectiveDefenseTask();
+
+        if ((virtualized > 0 || rematerialized > 0) && IA_Log.IsOn(IA_LogCategory.Military))
+            IA_Log.Write(IA_LogCategory.Military, string.Format("Area %1: virtualized %2, re-materialized %3, %4 groups virtual.", m_area.GetName(), virtualized, rematerialized, stillVirtual));
+    }
+
+    // Keeps IA_SpawnPointPool filling around the centers inbound spawns use here.
+    private void SpawnPointPoolTask()
+    {
+        if (!m_area)
+            return;
+
+        int roadGroup = IA_VehicleManager.GetActiveGroup();
+        IA_SpawnPointPool pool = IA_SpawnPointPool.Get();
+        pool.Touch(m_area.GetOrigin(), roadGroup);
+        if (m_isInDefendMode && m_defendTarget != vector.Zero)
+            pool.Touch(m_defendTarget, roadGroup);
+    }
+
+    // Called by member groups whenever their alive counts change (IA_AiGroup.RefreshAliveCount).
+    void OnGroupStrengthDelta(int aliveDelta, int waveDelta, int spawnedWaveDelta)
+    {
+        m_aliveMilitary += aliveDelta;
+        m_aliveDefendWave += waveDelta;
+        m_aliveSpawnedDefendWave += spawnedWaveDelta;
+    }
+
+    // Defend-wave units whose groups have spawned (queued waves excluded).
+    int GetAliveSpawnedDefendWaveCount()
+    {
+        return m_aliveSpawnedDefendWave;
     }
 
     void Cleanup()
@@ -605,6 +762,7 @@ class IA_AreaInstance
             if (group)
             {
                 group.Despawn();
+                group.DetachStrengthSink(this);
             }
         }
         m_military.Clear();
@@ -667,6 +825,7 @@ class IA_AreaInstance
         if (group && m_military.Find(group) == -1) // Avoid duplicates
         {
             m_military.Insert(group);
+            group.AttachStrengthSink(this);
             // Optionally update strength immediately?
             // OnStrengthChange(m_strength + group.GetAliveCount());
             
@@ -718,6 +877,7 @@ class IA_AreaInstance
         {
             m_military.Remove(index);
         }
+        group.DetachStrengthSink(this);
     
         if (m_assignedGroupStates.Contains(group))
         {
@@ -830,7 +990,7 @@ class IA_AreaInstance
         m_reinforcementWaveDelayTimer = 0;
     }
 
-    // One ReinforcementsTask tick is ~20s (RunNextTask cycle). 5-9 ticks = ~100-180s between waves.
+    // One ReinforcementsTask tick is ~20s (IA_TaskScheduler.AREA_TASK_PERIOD_MS). 5-9 ticks = ~100-180s between waves.
     private int RollReinforcementWaveDelayTicks()
     {
         return Math.RandomInt(5, 10);
@@ -897,8 +1057,8 @@ class IA_AreaInstance
                     }
                     else
                     {
-                        Print(string.Format("[AreaInstance.ReinforcementsTask] Area %1 failed to spawn group in current wave (e.g., no safe spot). Groups spawned: %2/%3. Resetting delay to retry.",
-                             m_area.GetName(), m_reinforcementGroupsSpawned, m_totalReinforcementQuota), LogLevel.WARNING);
+                        if (IA_Log.Allow(IA_LogCategory.Military, "Reinforcements.SpawnFailed", 10000, LogLevel.WARNING))
+                            IA_Log.Write(IA_LogCategory.Military, string.Format("Area %1 failed to spawn group in current wave (e.g., no safe spot). Groups spawned: %2/%3. Resetting delay to retry.", m_area.GetName(), m_reinforcementGroupsSpawned, m_totalReinforcementQuota), LogLevel.WARNING);
                          m_reinforcementWaveDelayTimer = RollReinforcementWaveDelayTicks();
 
                          if (m_reinforcementGroupsSpawned >= m_totalReinforcementQuota) {
@@ -914,10 +1074,9 @@ class IA_AreaInstance
 
     private void StrengthUpdateTask()
     {
-        int totalCount = 0;
+        int totalCount = m_aliveMilitary;
         foreach (IA_AiGroup g : m_military)
         {
-            totalCount = totalCount + g.GetAliveCount();
             if (g.IsEngagedWithEnemy())
             {
                 IA_Faction enemyFac = g.GetEngagedEnemyFaction();
@@ -1038,36 +1197,14 @@ class IA_AreaInstance
 
         if (isUnderAttack)
         {
-            vector dangerSum = vector.Zero;
-            int dangerCount = 0;
             float dangerLevelSum = 0.0;
             int dangerLevelCount = 0;
-            vector currentDangerPos;
-            int latestDangerTime = 0; // Track latest danger time used in calculation
             const int MAX_THREAT_STALENESS_SECONDS = 90; // If danger info is older than this, consider it stale
+            vector assessedThreat;
+            bool hasThreat = ComputeAreaThreatLocation(MAX_THREAT_STALENESS_SECONDS, assessedThreat);
 
             foreach (IA_AiGroup g_threat : m_military) {
-                int groupLastDangerTime = g_threat.GetLastDangerEventTime();
-                int timeSinceLastDanger = System.GetUnixTime() - groupLastDangerTime;
-
-                // Only consider groups with relatively recent danger info for position calculation
-                if (g_threat && groupLastDangerTime > 0 && timeSinceLastDanger < MAX_THREAT_STALENESS_SECONDS )
-                {
-                    currentDangerPos = g_threat.GetLastDangerPosition();
-                    if(currentDangerPos != vector.Zero)
-                    {
-                         // Only consider danger points reasonably within or near the area
-                         if (vector.DistanceSq(currentDangerPos, m_area.GetOrigin()) < (m_area.GetRadius() * 1.5) * (m_area.GetRadius() * 1.5)) // Increased radius slightly
-                         {
-                            dangerSum += currentDangerPos;
-                            dangerCount++;
-                            if (groupLastDangerTime > latestDangerTime) {
-                                latestDangerTime = groupLastDangerTime; // Update latest time stamp
-                            }
-                         }
-                    }
-                }
-                // Still calculate overall danger level based on all groups reporting any danger (less strict time limit?)
+                // Overall danger level based on all groups reporting any danger
                 float groupDanger = g_threat.GetCurrentDangerLevel();
                  if (groupDanger > 0) {
                      dangerLevelSum += groupDanger;
@@ -1080,9 +1217,9 @@ class IA_AreaInstance
             }
 
             // Check if we calculated a position AND if the data isn't too stale
-            if (dangerCount > 0)
+            if (hasThreat)
             {
-                primaryThreatLocation = dangerSum / dangerCount;
+                primaryThreatLocation = assessedThreat;
                 validThreatLocation = true; // Position calculated from recent data
                 //Print(string.Format("[AreaInstance.MilitaryTask] Threat assessed from recent group danger near: %1 (Latest event: %2s ago)",
 //                    primaryThreatLocation.ToString(), System.GetUnixTime() - latestDangerTime), LogLevel.DEBUG);
@@ -1139,8 +1276,8 @@ class IA_AreaInstance
             }
             // --- END MODIFIED ---
             
-            if (dangerCount > 0) {
-                primaryThreatLocation = dangerSum / dangerCount;
+            if (hasThreat) {
+                primaryThreatLocation = assessedThreat;
                 validThreatLocation = true;
                 //Print(string.Format("[AreaInstance.MilitaryTask] Area '%1' UNDER ATTACK. Threat assessed from own groups near: %2", m_area.GetName(), primaryThreatLocation.ToString()), LogLevel.DEBUG);
             } else {
@@ -1153,7 +1290,13 @@ class IA_AreaInstance
         }
 
         // --- Stage 2: Role Calculation ---
-        int totalMilitaryGroups = m_military.Count();
+        // Virtualized groups can't move, so they don't fill any role quota.
+        int totalMilitaryGroups = 0;
+        foreach (IA_AiGroup g_count : m_military)
+        {
+            if (g_count && !g_count.IsVirtualized())
+                totalMilitaryGroups++;
+        }
         // --- Renamed local variables to avoid conflict with class members ---
         int localTargetDefenders = 0;
         int localTargetAttackers = 0;
@@ -1256,9 +1399,8 @@ class IA_AreaInstance
             }
             // --- Use renamed local variables ---
             if (localTargetDefenders + localTargetAttackers + localTargetFlankers != totalMilitaryGroups) {
-                 Print(string.Format("[AreaInstance.MilitaryTask] Role Calc NORMAL: Role counts don't match total! Total=%1, Def=%2, Att=%3, Flk=%4",
-                    // --- Use renamed local variables ---
-                    totalMilitaryGroups, localTargetDefenders, localTargetAttackers, localTargetFlankers), LogLevel.ERROR);
+                 if (IA_Log.Allow(IA_LogCategory.Military, "MilitaryOrders.RoleMismatch", 10000, LogLevel.ERROR))
+                     IA_Log.Write(IA_LogCategory.Military, string.Format("Role Calc NORMAL: Role counts don't match total! Total=%1, Def=%2, Att=%3, Flk=%4", totalMilitaryGroups, localTargetDefenders, localTargetAttackers, localTargetFlankers), LogLevel.ERROR);
                  // --- Use renamed local variables ---
                  localTargetAttackers = totalMilitaryGroups - localTargetDefenders - localTargetFlankers;
             }
@@ -1274,7 +1416,7 @@ class IA_AreaInstance
             // For each group currently assigned as DefendPatrol, update to Defending
             foreach (IA_AiGroup g : m_military)
             {
-                if (!g || g.GetAliveCount() == 0)
+                if (!g || g.GetAliveCount() == 0 || g.IsVirtualized())
                     continue;
                     
                 // --- BEGIN ADDED: Skip groups in defend mode ---
@@ -1304,7 +1446,7 @@ class IA_AreaInstance
         // Collect all pending state change requests
         foreach (IA_AiGroup g : m_military)
         {
-            if (!g || g.GetAliveCount() == 0)
+            if (!g || g.GetAliveCount() == 0 || g.IsVirtualized())
                 continue;
                 
             // --- BEGIN ADDED: Skip groups in defend mode AND objective units---
@@ -1945,9 +2087,10 @@ class IA_AreaInstance
                 else postReassignmentOther++;
             } else postReassignmentOther++; // Should not happen
         }
-        Print(string.Format("[AreaInstance.MilitaryTask] Post-Reassignment State Map: Def=%1, Att=%2, Flk=%3, Other=%4 (Targets: Def=%5, Att=%6, Flk=%7)",
-            postReassignmentDefenders, postReassignmentAttackers, postReassignmentFlankers, postReassignmentOther,
-            localTargetDefenders, localTargetAttackers, localTargetFlankers), LogLevel.DEBUG);
+        if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+            IA_Log.Write(IA_LogCategory.Military, string.Format("Post-Reassignment State Map: Def=%1, Att=%2, Flk=%3, Other=%4 (Targets: Def=%5, Att=%6, Flk=%7)",
+                postReassignmentDefenders, postReassignmentAttackers, postReassignmentFlankers, postReassignmentOther,
+                localTargetDefenders, localTargetAttackers, localTargetFlankers), LogLevel.DEBUG);
         // --- END ADDED ---
 
         // --- Stage 7: Enforcement & Idle Handling ---
@@ -2047,8 +2190,9 @@ class IA_AreaInstance
                     m_stateStartTimes.Set(g, currentTime);
                     m_stateStability.Set(g, 0);
                     g.SetTacticalState(IA_GroupTacticalState.Attacking, assaultTarget, null, true);
-                    Print(string.Format("[MilitaryOrderTask] Approaching group at %1 made contact, breaking off to Attacking toward %2.",
-                        g.GetOrigin().ToString(), assaultTarget.ToString()), LogLevel.DEBUG);
+                    if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+                        IA_Log.Write(IA_LogCategory.Military, string.Format("Approaching group at %1 made contact, breaking off to Attacking toward %2.",
+                            g.GetOrigin().ToString(), assaultTarget.ToString()), LogLevel.DEBUG);
                     continue;
                 }
 
@@ -2058,8 +2202,9 @@ class IA_AreaInstance
                     m_stateStartTimes.Set(g, currentTime);
                     m_stateStability.Set(g, 0);
                     g.SetTacticalState(IA_GroupTacticalState.Attacking, assaultTarget, null, true);
-                    Print(string.Format("[MilitaryOrderTask] Approaching group at %1 reached jump-off, transitioning to Attacking toward %2.",
-                        g.GetOrigin().ToString(), assaultTarget.ToString()), LogLevel.DEBUG);
+                    if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+                        IA_Log.Write(IA_LogCategory.Military, string.Format("Approaching group at %1 reached jump-off, transitioning to Attacking toward %2.",
+                            g.GetOrigin().ToString(), assaultTarget.ToString()), LogLevel.DEBUG);
                     continue;
                 }
 
@@ -2664,7 +2809,6 @@ class IA_AreaInstance
         // If none exist, keep the original random-in-area spawn.
         ref array<IA_AISpawnPoint> spawnPoints = IA_AISpawnPoint.GetSpawnPointsInArea(m_area);
         Print(string.Format("[IA_AreaInstance] Found %1 spawn points inside area %2.", spawnPoints.Count(), m_area.GetName()), LogLevel.NORMAL);
-		int accumulatedDelay = 0;
 
         for (int i = 0; i < scaledNumberOfGroupsToSpawn; i = i + 1)
         {
@@ -2709,11 +2853,7 @@ class IA_AreaInstance
                 continue;
             }
             
-            GetGame().GetCallqueue().CallLater(this._SpawnSingleAiGroupAndAddToArea, accumulatedDelay, false, pos, scaledUnitCountForThisGroup, AreaFaction, useExactPos);
-            ////Print(string.Format("[IA_AreaInstance.GenerateRandomAiGroups] Area %1: Scheduled group %2/%3 spawn. Pos: %4, Units: %5. Delay: %6ms",
-            //    m_area.GetName(), i + 1, scaledNumberOfGroupsToSpawn, pos.ToString(), scaledUnitCountForThisGroup, accumulatedDelay), LogLevel.DEBUG);
-            
-            accumulatedDelay += Math.RandomInt(600, 5000);
+            QueueAreaGroupSpawn(pos, scaledUnitCountForThisGroup, AreaFaction, useExactPos);
 
         }
         
@@ -2761,7 +2901,6 @@ class IA_AreaInstance
             return;
         }
 
-        int delay = 0;
         foreach (IEntity mortar : mortars)
         {
             if (!mortar)
@@ -2770,12 +2909,11 @@ class IA_AreaInstance
             vector pos = mortar.GetOrigin();
             pos[2] = pos[2] + 1.5;
             pos[1] = GetGame().GetWorld().GetSurfaceY(pos[0], pos[2]);
-            GetGame().GetCallqueue().CallLater(this._SpawnSingleAiGroupAndAddToArea, delay, false, pos, 1, m_AreaFaction, true);
-            delay = delay + 250;
+            QueueAreaGroupSpawn(pos, 1, m_AreaFaction, true);
         }
 
         int guardCount = IA_AreaMarker.GetMortarPitGuardCount();
-        GetGame().GetCallqueue().CallLater(this._SpawnSingleAiGroupAndAddToArea, delay, false, m_area.GetOrigin(), guardCount, m_AreaFaction, true);
+        QueueAreaGroupSpawn(m_area.GetOrigin(), guardCount, m_AreaFaction, true);
 
         Print(string.Format("[IA][MortarPit] AI scheduled: %1 gunners on tubes, %2 guards", mortars.Count(), guardCount), LogLevel.NORMAL);
     }
@@ -3273,7 +3411,7 @@ class IA_AreaInstance
                 Print(string.Format("[IA_AreaInstance.GenerateCivilians] CRITICAL: m_area is null for instance when trying to assign to civilian group. Area Name: %1 (This should not happen if instance was created properly)", m_area.GetName()), LogLevel.ERROR);
             }
             
-            civ.Spawn();
+            IA_SpawnQueue.Get().Enqueue(new IA_CivilianSpawnRequest(civ));
             m_civilians.Insert(civ);
         }
 		
@@ -3650,7 +3788,7 @@ class IA_AreaInstance
             {
                 float approachingDanger = group.GetDangerLevel();
                 if (approachingDanger > 0.8)
-                    ApplyEnemySpottedReactionToGroup(group, group.GetOrigin(), approachingDanger);
+                    ApplyEnemySpottedReactionToGroup(group, GetReactionSourcePosition(group), approachingDanger);
                 processedGroups.Insert(group, true);
                 continue;
             }
@@ -3698,7 +3836,7 @@ class IA_AreaInstance
                 //    group.GetOrigin().ToString(), dangerLevel), LogLevel.DEBUG);
                     
                 // Add to central reaction manager for later group-wide processing
-                m_centralReactionManager.TriggerReaction(IA_AIReactionType.UnderFire, dangerLevel, group.GetOrigin()); // Use TriggerReaction
+                m_centralReactionManager.TriggerReaction(IA_AIReactionType.UnderFire, dangerLevel, GetReactionSourcePosition(group)); // Use TriggerReaction
                 
                 // Mark this group as processed
                 processedGroups.Insert(group, true);
@@ -3712,7 +3850,7 @@ class IA_AreaInstance
                 if (!processedGroups.Contains(group))
                 {
                     // Create a reaction state and apply it
-                    ApplyEnemySpottedReactionToGroup(group, group.GetOrigin(), dangerLevel);
+                    ApplyEnemySpottedReactionToGroup(group, GetReactionSourcePosition(group), dangerLevel);
                     
                     // Mark this group as processed
                     processedGroups.Insert(group, true);
@@ -3763,6 +3901,22 @@ class IA_AreaInstance
         }
     }
 
+    // Hottest threat-map spot within REACTION_SOURCE_RADIUS_M of the group, so reactions
+    // point at the contact. Falls back to the group's own position like before.
+    private vector GetReactionSourcePosition(IA_AiGroup group)
+    {
+        vector groupPos = group.GetOrigin();
+        IA_ThreatMap threatMap = IA_ThreatMap.GetIfCovers(groupPos, REACTION_SOURCE_RADIUS_M);
+        if (!threatMap)
+            return groupPos;
+
+        float heat;
+        vector hotspot = threatMap.GetHotspot(groupPos, REACTION_SOURCE_RADIUS_M, heat);
+        if (heat <= 0)
+            return groupPos;
+        return hotspot;
+    }
+
     // --- Add these helper methods for reaction processing ---
     private void BreakApproachingToAttack(IA_AiGroup group, vector targetPos)
     {
@@ -3776,8 +3930,8 @@ class IA_AreaInstance
         m_stateStartTimes.Set(group, System.GetUnixTime());
         m_stateStability.Set(group, 0);
         group.SetTacticalState(IA_GroupTacticalState.Attacking, targetPos, null, true);
-        Print(string.Format("[AreaInstance] Approaching group at %1 broke off to Attacking toward %2.",
-            group.GetOrigin().ToString(), targetPos.ToString()), LogLevel.DEBUG);
+        if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+            IA_Log.Write(IA_LogCategory.Military, string.Format("Approaching group at %1 broke off to Attacking toward %2.", group.GetOrigin().ToString(), targetPos.ToString()), LogLevel.DEBUG);
     }
 
     private void ApplyUnderFireReactionToGroup(IA_AiGroup group, vector sourcePos, float intensity)
@@ -4094,6 +4248,7 @@ class IA_AreaInstance
     private ref IA_AIReactionManager m_centralReactionManager = new IA_AIReactionManager();
     private int m_lastReactionProcessTime = 0;
     private const int REACTION_PROCESS_INTERVAL = 20; // Process reactions every 30 seconds
+    private const float REACTION_SOURCE_RADIUS_M = 300.0; // Threat-map search radius for reaction source positions
 
     // --- Near the top, before any methods, add these class member variables
     // Threat investigation tracking
@@ -4159,13 +4314,15 @@ class IA_AreaInstance
             return;
         }
 		
-		Print(string.Format("[AreaInstance] Checking civilian status for area %1. Civ count =" + m_aliveCivilianCount, m_area.GetName()), LogLevel.NORMAL);
+		if (IA_Log.IsOn(IA_LogCategory.Civilian, LogLevel.DEBUG))
+			IA_Log.Write(IA_LogCategory.Civilian, string.Format("Checking civilian status for area %1. Civ count = %2", m_area.GetName(), m_aliveCivilianCount), LogLevel.DEBUG);
 		
         if (!m_canSpawn || m_civilians.IsEmpty())
 		{
 			if(m_aliveCivilianCount != 0)
             {
-                Print(string.Format("[AreaInstance] Civilian list for area %1 is empty. Resetting count to 0. Initial: %2, Previous: %3", m_area.GetName(), m_initialCivilianCount, m_aliveCivilianCount), LogLevel.DEBUG);
+                if (IA_Log.IsOn(IA_LogCategory.Civilian, LogLevel.DEBUG))
+                    IA_Log.Write(IA_LogCategory.Civilian, string.Format("Civilian list for area %1 is empty. Resetting count to 0. Initial: %2, Previous: %3", m_area.GetName(), m_initialCivilianCount, m_aliveCivilianCount), LogLevel.DEBUG);
 				m_aliveCivilianCount = 0;
             }
             return;
@@ -4198,8 +4355,8 @@ class IA_AreaInstance
 						m_civilians.Remove(i); // Clean up any that died during spawn
 				}
 				
-				Print(string.Format("[AreaInstance] Initial civilian spawn for area %1 complete. Initial: %2, Actually Alive: %3", 
-					m_area.GetName(), m_initialCivilianCount, initialAliveCount), LogLevel.DEBUG);
+				if (IA_Log.IsOn(IA_LogCategory.Civilian, LogLevel.DEBUG))
+					IA_Log.Write(IA_LogCategory.Civilian, string.Format("Initial civilian spawn for area %1 complete. Initial: %2, Actually Alive: %3", m_area.GetName(), m_initialCivilianCount, initialAliveCount), LogLevel.DEBUG);
 				m_aliveCivilianCount = initialAliveCount;
 			}
 		}
@@ -4219,14 +4376,18 @@ class IA_AreaInstance
 		int currentAliveCount = m_civilians.Count();
 		if (m_aliveCivilianCount != currentAliveCount)
         {
-            Print(string.Format("[AreaInstance] Civilian count for area %1 updated. Initial: %2, Previous: %3, Current: %4.", 
-                m_area.GetName(), m_initialCivilianCount, m_aliveCivilianCount, currentAliveCount), LogLevel.DEBUG);
+            if (IA_Log.IsOn(IA_LogCategory.Civilian, LogLevel.DEBUG))
+                IA_Log.Write(IA_LogCategory.Civilian, string.Format("Civilian count for area %1 updated. Initial: %2, Previous: %3, Current: %4.", m_area.GetName(), m_initialCivilianCount, m_aliveCivilianCount, currentAliveCount), LogLevel.DEBUG);
             m_aliveCivilianCount = currentAliveCount;
         }
 		// --- END NEW LOGIC ---
 		
         foreach (IA_AiGroup g : m_civilians)
         {
+			// Still waiting in IA_SpawnQueue.
+			if (!g.IsSpawned())
+				continue;
+
 			// The list now only contains alive, spawned civilians, so we just give them orders.
             
             // --- NEW SECTION: Check for pending state change requests from civilian groups ---
@@ -4363,6 +4524,44 @@ class IA_AreaInstance
  //           critical), LogLevel.DEBUG);
     }
 
+    // Threat position within 1.5x the area radius, weighted by danger. Reads the shared
+    // threat map; if it doesn't cover the area, falls back to the last danger positions
+    // of groups whose newest danger event is younger than maxAgeSeconds.
+    private bool ComputeAreaThreatLocation(int maxAgeSeconds, out vector outPos)
+    {
+        outPos = vector.Zero;
+        float searchRadius = m_area.GetRadius() * 1.5;
+        IA_ThreatMap threatMap = IA_ThreatMap.GetIfCovers(m_area.GetOrigin(), searchRadius);
+        if (threatMap)
+        {
+            float heat;
+            outPos = threatMap.GetCentroid(m_area.GetOrigin(), searchRadius, heat);
+            return heat > 0;
+        }
+
+        array<vector> dangerPositions = {};
+        array<float> dangerWeights = {};
+        int now = System.GetUnixTime();
+        foreach (IA_AiGroup g_threat : m_military)
+        {
+            if (!g_threat || g_threat.GetLastDangerEventTime() <= 0 || now - g_threat.GetLastDangerEventTime() >= maxAgeSeconds)
+                continue;
+
+            vector dangerPos = g_threat.GetLastDangerPosition();
+            if (dangerPos == vector.Zero || vector.DistanceSq(dangerPos, m_area.GetOrigin()) >= searchRadius * searchRadius)
+                continue;
+
+            // Groups under heavier fire pull the estimate toward their contact
+            dangerPositions.Insert(dangerPos);
+            dangerWeights.Insert(Math.Max(g_threat.GetCurrentDangerLevel(), THREAT_MIN_WEIGHT));
+        }
+
+        if (dangerPositions.IsEmpty())
+            return false;
+        outPos = IA_VectorUtils.WeightedCentroid(dangerPositions, dangerWeights);
+        return true;
+    }
+
     // Add this function near the end of the class, before the closing bracket
     // Attempts to prioritize rebuilding the attacking force when it has been decimated
     private void PrioritizeAttackerReplacement()
@@ -4384,9 +4583,10 @@ class IA_AreaInstance
 
         // --- BEGIN ADDED: Calculate Primary Threat Location ---
         vector primaryThreatLocation = m_area.GetOrigin(); // Default
-        bool validThreatLocation = false;
-        vector dangerSum = vector.Zero;
-        int dangerCount = 0;
+        vector assessedThreat;
+        bool validThreatLocation = ComputeAreaThreatLocation(60, assessedThreat);
+        if (validThreatLocation)
+            primaryThreatLocation = assessedThreat;
         
         foreach (IA_AiGroup g_threat : m_military)
         {
@@ -4394,21 +4594,6 @@ class IA_AreaInstance
                 continue;
                 
             totalAvailableGroups++; // Count available groups here
-            
-            // Check for engagement or recent danger
-            if (g_threat.IsEngagedWithEnemy() || (System.GetUnixTime() - g_threat.GetLastDangerEventTime() < 60))
-            {
-                 vector currentDangerPos = g_threat.GetLastDangerPosition();
-                 if(currentDangerPos != vector.Zero)
-                 {
-                      // Only consider danger points reasonably within or near the area
-                      if (vector.DistanceSq(currentDangerPos, m_area.GetOrigin()) < (m_area.GetRadius() * 1.5) * (m_area.GetRadius() * 1.5))
-                      {
-                         dangerSum += currentDangerPos;
-                         dangerCount++;
-                      }
-                 }
-            }
 
             IA_GroupTacticalState state;
             if (m_assignedGroupStates.Find(g_threat, state) && state == IA_GroupTacticalState.Attacking)
@@ -4421,16 +4606,6 @@ class IA_AreaInstance
             // --- END ADDED ---
         }
 
-        if (dangerCount > 0)
-        {
-            primaryThreatLocation = dangerSum / dangerCount;
-            validThreatLocation = true;
-            //Print(string.Format("[AreaInstance.PrioritizeAttackerReplacement] Threat location calculated: %1", primaryThreatLocation.ToString()), LogLevel.DEBUG);
-        }
-        else
-        {
-             //Print(string.Format("[AreaInstance.PrioritizeAttackerReplacement] No specific threat location found, will use area origin as fallback."), LogLevel.DEBUG);
-        }
         // --- END ADDED ---
         
         // If no groups available, we can't do anything
@@ -4539,24 +4714,26 @@ class IA_AreaInstance
     // --- BEGIN ADDED: Spawn Reinforcement Wave Logic ---
     bool SpawnReinforcementWave(int groupsToSpawn, Faction AreaFaction, bool forDefendMission = false)
     {
-		Print(string.Format("SpawnReinforcementWave called for area %1. Request: %2 groups. Current: %3/%4. ForDefend: %5", 
-		    m_area.GetName(), groupsToSpawn, m_reinforcementGroupsSpawned, m_totalReinforcementQuota, forDefendMission), LogLevel.DEBUG);
+		if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+			IA_Log.Write(IA_LogCategory.Military, string.Format("SpawnReinforcementWave called for area %1. Request: %2 groups. Current: %3/%4. ForDefend: %5", m_area.GetName(), groupsToSpawn, m_reinforcementGroupsSpawned, m_totalReinforcementQuota, forDefendMission), LogLevel.DEBUG);
 		
 		// --- BEGIN ADDED: Log defend mode status ---
 		if (m_isInDefendMode)
 		{
-		    Print(string.Format("[SpawnReinforcementWave] Area is in DEFEND MODE. Defend target: %1", m_defendTarget.ToString()), LogLevel.DEBUG);
+		    if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+		    	IA_Log.Write(IA_LogCategory.Military, string.Format("Area is in DEFEND MODE. Defend target: %1", m_defendTarget.ToString()), LogLevel.DEBUG);
 		}
 		else
 		{
-		    Print(string.Format("[SpawnReinforcementWave] Area is in NORMAL MODE. Using area origin: %1", m_area.GetOrigin().ToString()), LogLevel.DEBUG);
+		    if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+		    	IA_Log.Write(IA_LogCategory.Military, string.Format("Area is in NORMAL MODE. Using area origin: %1", m_area.GetOrigin().ToString()), LogLevel.DEBUG);
 		}
 		// --- END ADDED ---
         // Allow defend missions to bypass normal reinforcement quota
         if (!forDefendMission && m_reinforcementGroupsSpawned >= m_totalReinforcementQuota)
         {
-            Print(string.Format("[AreaInstance.SpawnReinforcementWave] Area %1 cannot spawn: Quota met (%2/%3).", 
-                m_area.GetName(), m_reinforcementGroupsSpawned, m_totalReinforcementQuota), LogLevel.DEBUG);
+            if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+                IA_Log.Write(IA_LogCategory.Military, string.Format("Area %1 cannot spawn: Quota met (%2/%3).", m_area.GetName(), m_reinforcementGroupsSpawned, m_totalReinforcementQuota), LogLevel.DEBUG);
             return false; // Quota already met
         }
 		
@@ -4572,7 +4749,8 @@ class IA_AreaInstance
             defendFireteamSizes = new array<int>();
             IA_BuildDefendFireteamSizes(unitBudget, defendFireteamSizes);
             actualSpawnCount = defendFireteamSizes.Count();
-            Print(string.Format("[AreaInstance.SpawnReinforcementWave] DEFEND MISSION: unit budget %1 -> %2 fireteams", unitBudget, actualSpawnCount), LogLevel.DEBUG);
+            if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+                IA_Log.Write(IA_LogCategory.Military, string.Format("DEFEND MISSION: unit budget %1 -> %2 fireteams", unitBudget, actualSpawnCount), LogLevel.DEBUG);
         }
         else
         {
@@ -4580,12 +4758,13 @@ class IA_AreaInstance
         }
         if (actualSpawnCount <= 0) 
         {
-            Print(string.Format("[AreaInstance.SpawnReinforcementWave] Area %1 cannot spawn: Calculated spawn count is zero or negative.", m_area.GetName()), LogLevel.DEBUG);
+            if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+                IA_Log.Write(IA_LogCategory.Military, string.Format("Area %1 cannot spawn: Calculated spawn count is zero or negative.", m_area.GetName()), LogLevel.DEBUG);
             return false; // Should not happen if initial check passed, but safety first
         }
         
-        Print(string.Format("[AreaInstance.SpawnReinforcementWave] Area %1 attempting to spawn %2 reinforcement groups (Quota: %3/%4).", 
-            m_area.GetName(), actualSpawnCount, m_reinforcementGroupsSpawned, m_totalReinforcementQuota), LogLevel.DEBUG);
+        if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+            IA_Log.Write(IA_LogCategory.Military, string.Format("Area %1 attempting to spawn %2 reinforcement groups (Quota: %3/%4).", m_area.GetName(), actualSpawnCount, m_reinforcementGroupsSpawned, m_totalReinforcementQuota), LogLevel.DEBUG);
 
         for (int i = 0; i < actualSpawnCount; i++)
         {
@@ -4594,19 +4773,43 @@ class IA_AreaInstance
 			if (forDefendMission && defendFireteamSizes)
 				unitCountOverride = defendFireteamSizes[i];
 
-			ref IA_ReinforcementSpawnRequest request = new IA_ReinforcementSpawnRequest();
+			IA_ReinforcementSpawnRequest request = new IA_ReinforcementSpawnRequest();
+			request.m_areaInstance = this;
 			request.m_areaFaction = AreaFaction;
 			request.m_forDefendMission = forDefendMission;
 			request.m_sectorIndex = sectorIndex;
 			request.m_unitCountOverride = unitCountOverride;
+			if (forDefendMission)
+				request.m_priority = IA_SpawnPriority.DefendWave;
+			else
+				request.m_priority = IA_SpawnPriority.Reinforcement;
+			// Squads still arrive one after another; the queue only decides the frame they spawn in.
 			int spawnDelayMs = 2000 + (i * Math.RandomInt(12000, 20000));
-			GetGame().GetCallqueue().CallLater(this.SpawnReinforcementEnactorFromRequest, spawnDelayMs, false, request);
+			IA_SpawnQueue.Get().Enqueue(request, spawnDelayMs);
         }
         
         return true;
     }
     // --- END ADDED ---
 
+	//! IA_SpawnQueue callback once a reinforcement squad's characters are in. A squad that
+	//! came up empty is discarded by its group, so it hands its quota slot back.
+	protected void OnReinforcementUnitsSpawned(IA_SpawnRequest request)
+	{
+		IA_AiGroup grp = request.GetGroup();
+		if (grp && grp.GetSpawnedUnitCount() > 0)
+		{
+			if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+				IA_Log.Write(IA_LogCategory.Military, string.Format("Reinforcement squad for %1 is in with %2 units.", m_area.GetName(), grp.GetSpawnedUnitCount()), LogLevel.DEBUG);
+			return;
+		}
+
+		if (m_reinforcementGroupsSpawned > 0)
+			m_reinforcementGroupsSpawned--;
+		if (IA_Log.Allow(IA_LogCategory.Military, "Reinforcements.Empty", 10000, LogLevel.WARNING))
+			IA_Log.Write(IA_LogCategory.Military, string.Format("Reinforcement squad for %1 spawned no units; quota slot returned (%2/%3).", m_area.GetName(), m_reinforcementGroupsSpawned, m_totalReinforcementQuota), LogLevel.WARNING);
+	}
+
 	void SpawnReinforcementEnactorFromRequest(IA_ReinforcementSpawnRequest request)
 	{
 		if (!request)
@@ -4662,8 +4865,10 @@ class IA_AreaInstance
             // 5. Spawn and Integrate
             if (grp)
             {
+                grp.SetSpawnPriority(IA_SpawnPriority.Reinforcement);
                 grp.SetAssignedArea(m_area);
-                Print(string.Format("[AreaInstance.SpawnReinforcementWave] Explicitly assigned reinforcement group to area %1", m_area.GetName()), LogLevel.DEBUG);
+                if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+                    IA_Log.Write(IA_LogCategory.Military, string.Format("Explicitly assigned reinforcement group to area %1", m_area.GetName()), LogLevel.DEBUG);
                 
                 if (forDefendMission)
                     grp.SetDefendWaveGroup(true);
@@ -4685,7 +4890,8 @@ class IA_AreaInstance
                     targetPos = m_defendTarget;
                     initialState = IA_GroupTacticalState.Attacking;
                     grp.SetDefendMode(true, m_defendTarget);
-                    Print(string.Format("[AreaInstance.SpawnReinforcementWave] Setting reinforcement group to defend mode, target: %1", m_defendTarget.ToString()), LogLevel.DEBUG);
+                    if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+                        IA_Log.Write(IA_LogCategory.Military, string.Format("Setting reinforcement group to defend mode, target: %1", m_defendTarget.ToString()), LogLevel.DEBUG);
                 }
                 else
                 {
@@ -4705,8 +4911,8 @@ class IA_AreaInstance
                     m_assignedGroupStates.Set(grp, IA_GroupTacticalState.Approaching);
                     grp.RemoveAllOrders();
                     grp.AddOrder(targetPos, IA_AiOrder.Move, true);
-                    Print(string.Format("[SpawnReinforcementWave] Zone reinforce hold at %1 for %2.",
-                        targetPos.ToString(), m_area.GetName()), LogLevel.DEBUG);
+                    if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+                        IA_Log.Write(IA_LogCategory.Military, string.Format("Zone reinforce hold at %1 for %2.", targetPos.ToString(), m_area.GetName()), LogLevel.DEBUG);
                 }
                 // Defend fireteams: ~70% bee-line assault, ~30% flank via neighboring sector staging
                 else if (forDefendMission && m_isInDefendMode && m_defendTarget != vector.Zero)
@@ -4729,8 +4935,8 @@ class IA_AreaInstance
                         grp.AddOrder(stagingPos, IA_AiOrder.Move, true);
                         grp.AddOrder(targetPos, IA_AiOrder.SearchAndDestroy, false);
 
-                        Print(string.Format("[SpawnReinforcementWave] Defend flank fireteam staging at %1 (sector %2 -> %3).",
-                            stagingPos.ToString(), sectorIndex, flankSector), LogLevel.DEBUG);
+                        if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+                            IA_Log.Write(IA_LogCategory.Military, string.Format("Defend flank fireteam staging at %1 (sector %2 -> %3).", stagingPos.ToString(), sectorIndex, flankSector), LogLevel.DEBUG);
                     }
                 }
                 // For standard counter-attacks (not defend mode), route around the OBJ
@@ -4797,18 +5003,23 @@ class IA_AreaInstance
                     grp.AddOrder(stagingPos, IA_AiOrder.Move, true);
                     grp.AddOrder(targetPos, IA_AiOrder.SearchAndDestroy, false);
 
-                    Print(string.Format("[SpawnReinforcementWave] Staging at %1 (~300m from OBJ), arc: %2° (%3 routing pts).",
-                        stagingPos.ToString(), Math.Round(totalAngle * 180.0 / Math.PI), numArcPoints), LogLevel.DEBUG);
+                    if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+                        IA_Log.Write(IA_LogCategory.Military, string.Format("Staging at %1 (~300m from OBJ), arc: %2° (%3 routing pts).", stagingPos.ToString(), Math.Round(totalAngle * 180.0 / Math.PI), numArcPoints), LogLevel.DEBUG);
                 }
                 m_reinforcementGroupsSpawned++;
                 spawnedAny = true;
+
+                IA_SpawnRequest unitsRequest = grp.GetUnitsSpawnRequest();
+                if (unitsRequest)
+                    unitsRequest.GetOnComplete().Insert(OnReinforcementUnitsSpawned);
                 
-                Print(string.Format("[AreaInstance.SpawnReinforcementWave] Spawned reinforcement group (%1 units, faction: %2) at %3. Total spawned: %4/%5.",
-                    scaledUnitCount, typename.EnumToString(IA_Faction, IA_Faction.USSR), spawnPos.ToString(), m_reinforcementGroupsSpawned, m_totalReinforcementQuota), LogLevel.DEBUG);
+                if (IA_Log.IsOn(IA_LogCategory.Military, LogLevel.DEBUG))
+                    IA_Log.Write(IA_LogCategory.Military, string.Format("Spawned reinforcement group (%1 units, faction: %2) at %3. Total spawned: %4/%5.", scaledUnitCount, typename.EnumToString(IA_Faction, IA_Faction.USSR), spawnPos.ToString(), m_reinforcementGroupsSpawned, m_totalReinforcementQuota), LogLevel.DEBUG);
             }
             else
             {
-                Print(string.Format("[AreaInstance.SpawnReinforcementWave] Failed to create reinforcement group of type %1 at %2.", st, spawnPos.ToString()), LogLevel.WARNING);
+                if (IA_Log.Allow(IA_LogCategory.Military, "Reinforcements.CreateFailed", 10000, LogLevel.WARNING))
+                    IA_Log.Write(IA_LogCategory.Military, string.Format("Failed to create reinforcement group of type %1 at %2.", st, spawnPos.ToString()), LogLevel.WARNING);
             }
 		return spawnedAny;
 	
@@ -4914,7 +5125,7 @@ class IA_AreaInstance
 
                     // Release reservation first (if any)
                     IA_VehicleManager.ReleaseVehicleReservation(associatedVehicle);
-                    // Despawn the vehicle (this adds to GC and removes from IA_VehicleManager.m_vehicles)
+                    // Despawn the vehicle (this adds to GC and removes it from the IA_VehicleManager registry)
                     IA_VehicleManager.DespawnVehicle(associatedVehicle);
 
                     // Remove this vehicle from this AreaInstance's civilian vehicle tracking list
@@ -4976,7 +5187,7 @@ class IA_AreaInstance
             // Set all existing military groups to defend mode
             foreach (IA_AiGroup group : m_military)
             {
-                if (group && group.IsSpawned())
+                if (group && (group.IsSpawned() || group.IsVirtualized()))
                 {
                     group.SetDefendMode(true, defendPoint);
                 }
@@ -4990,7 +5201,7 @@ class IA_AreaInstance
             // Return all military groups to normal mode
             foreach (IA_AiGroup group : m_military)
             {
-                if (group && group.IsSpawned())
+                if (group && (group.IsSpawned() || group.IsVirtualized()))
                 {
                     group.SetDefendMode(false);
                 }
@@ -5472,7 +5683,26 @@ class IA_AreaInstance
 	
     // --- END ADDED ---
     
-    // --- BEGIN ADDED: Helper to spawn a single AI group with delay and add it ---
+    protected void QueueAreaGroupSpawn(vector spawnPos, int unitCountForGroup, Faction areaFactionForGroupTask, bool useExactPosition)
+    {
+        IA_AreaGroupSpawnRequest request = new IA_AreaGroupSpawnRequest();
+        request.m_areaInstance = this;
+        request.m_spawnPos = spawnPos;
+        request.m_unitCount = unitCountForGroup;
+        request.m_areaFaction = areaFactionForGroupTask;
+        request.m_useExactPosition = useExactPosition;
+        IA_SpawnQueue.Get().Enqueue(request);
+    }
+
+    void SpawnAreaGroupFromRequest(IA_AreaGroupSpawnRequest request)
+    {
+        if (!request)
+            return;
+
+        _SpawnSingleAiGroupAndAddToArea(request.m_spawnPos, request.m_unitCount, request.m_areaFaction, request.m_useExactPosition);
+    }
+
+    // --- BEGIN ADDED: Helper to spawn a single AI group and add it ---
     private void _SpawnSingleAiGroupAndAddToArea(vector spawnPos, int unitCountForGroup, Faction areaFactionForGroupTask, bool useExactPosition = false)
     {
         if (!m_area) // Ensure area instance is still valid
@@ -5531,23 +5761,9 @@ class IA_AreaInstance
 	
 
     // --- BEGIN ADDED: Helper to trigger global notifications ---
-	void TriggerGlobalNotification(string messageType, string taskTitle)
+	void TriggerGlobalNotification(IA_NotificationType type, string taskTitle)
 	{
-
-		array<int> playerIDs = new array<int>();
-		GetGame().GetPlayerManager().GetAllPlayers(playerIDs);
-		foreach (int playerID : playerIDs){
-			PlayerController pc = GetGame().GetPlayerManager().GetPlayerController(playerID);
-			if(pc){
-			 	SCR_ChimeraCharacter character = SCR_ChimeraCharacter.Cast(pc.GetControlledEntity());
-				if(character){
-					//Print("Going For SetUIOne on player " + playerID,LogLevel.DEBUG);
-			 		character.SetUIOne(messageType, taskTitle, playerID);
-				}
-			}
-			
-		}
-		return;
+		IA_NotificationReplicatorComponent.NotifyAll(type, taskTitle);
 	}
 	// --- END ADDED ---
 
@@ -5632,7 +5848,7 @@ class IA_AreaInstance
             Print(string.Format("[IA_AreaInstance] Radio Tower Defense ACTIVATED for area %1", m_area.GetName()), LogLevel.DEBUG);
             
             // Notify players that reinforcements have started and give instructions
-            TriggerGlobalNotification("RadioTowerDefenseStarted", m_area.GetName());
+            TriggerGlobalNotification(IA_NotificationType.RadioTowerDefenseStarted, m_area.GetName());
 
             // Waves reinforce the surrounding zone. Pinning them to the mast with
             // defend-mode S&D parks every group on the pad for the rest of the fight.
@@ -5663,7 +5879,6 @@ class IA_AreaInstance
         if (!m_area || m_area.GetAreaType() != IA_AreaType.RadioTower || m_radioTowerDestroyed)
             return;
         bool shouldBeActive = ShouldRadioTowerDefenseBeActive();
-        Print("Passed Area Check for " + m_area.GetName(), LogLevel.DEBUG); 
         // Activate or deactivate radio tower defense based on combat state.
         if (shouldBeActive && !m_isRadioTowerDefenseActive)
         {
@@ -5671,30 +5886,27 @@ class IA_AreaInstance
         }
         else if (!shouldBeActive && m_isRadioTowerDefenseActive)
         {
-            Print(string.Format("[IA_AreaInstance] AI in %1 are no longer in combat. Deactivating radio tower defense.", m_area.GetName()), LogLevel.DEBUG);
+            if (IA_Log.IsOn(IA_LogCategory.Area, LogLevel.DEBUG))
+                IA_Log.Write(IA_LogCategory.Area, string.Format("AI in %1 are no longer in combat. Deactivating radio tower defense.", m_area.GetName()), LogLevel.DEBUG);
             SetRadioTowerDefenseActive(false);
         }
         
         // If defense mode is not active at this point, do nothing further.
         if (!m_isRadioTowerDefenseActive)
             return;
-        Print("Passed Defense Check for " + m_area.GetName(), LogLevel.DEBUG);  
         // --- Continuous wave spawning logic ---
         int currentTime = System.GetTickCount();
         if (currentTime - m_radioTowerLastWaveSpawnTime >= RADIO_TOWER_WAVE_INTERVAL)
         {
-            int currentAICount = 0;
-            foreach (IA_AiGroup group : m_military)
-            {
-                if (group && group.IsDefendWaveGroup())
-                    currentAICount += group.GetAliveCount();
-            }
+            int currentAICount = m_aliveDefendWave;
 
-            Print(string.Format("[IA_AreaInstance] Radio Tower Defense Task: Checking AI count for %1. Current: %2, Target: %3.", m_area.GetName(), currentAICount, m_radioTowerTargetAICount), LogLevel.DEBUG);
+            if (IA_Log.IsOn(IA_LogCategory.Area, LogLevel.DEBUG))
+                IA_Log.Write(IA_LogCategory.Area, string.Format("Radio Tower Defense Task: Checking AI count for %1. Current: %2, Target: %3.", m_area.GetName(), currentAICount, m_radioTowerTargetAICount), LogLevel.DEBUG);
 
             if (currentAICount < m_radioTowerTargetAICount)
             {
-				Print(string.Format("[IA_AreaInstance] Radio Tower Defense Task: AI count low, spawning new wave for %1.", m_area.GetName()), LogLevel.DEBUG);
+				if (IA_Log.IsOn(IA_LogCategory.Area, LogLevel.DEBUG))
+					IA_Log.Write(IA_LogCategory.Area, string.Format("Radio Tower Defense Task: AI count low, spawning new wave for %1.", m_area.GetName()), LogLevel.DEBUG);
                 SpawnRadioTowerDefenseWave();
             }
             m_radioTowerLastWaveSpawnTime = currentTime;
@@ -5705,29 +5917,27 @@ class IA_AreaInstance
     {
         if (!m_radioTowerDefenseFaction)
         {
-            Print("[IA_RadioTowerDefense] Cannot spawn wave, faction is null.", LogLevel.WARNING);
+            if (IA_Log.Allow(IA_LogCategory.Area, "RadioTowerDefense.NoFaction", 10000, LogLevel.WARNING))
+                IA_Log.Write(IA_LogCategory.Area, "Cannot spawn wave, faction is null.", LogLevel.WARNING);
             return;
         }
 
         float scaleFactor = IA_Game.GetAIScaleFactor();
         int unitBudget = IA_GetDefendWaveUnitBudget(scaleFactor);
 
-        int currentWaveAI = 0;
-        foreach (IA_AiGroup group : m_military)
-        {
-            if (group && group.IsDefendWaveGroup())
-                currentWaveAI += group.GetAliveCount();
-        }
+        int currentWaveAI = m_aliveDefendWave;
         int room = m_radioTowerTargetAICount - currentWaveAI;
         if (room < unitBudget)
             unitBudget = room;
         if (unitBudget < 2)
         {
-            Print(string.Format("[IA_RadioTowerDefense] Skipping wave: only %1 unit slots under cap", unitBudget), LogLevel.DEBUG);
+            if (IA_Log.IsOn(IA_LogCategory.Area, LogLevel.DEBUG))
+                IA_Log.Write(IA_LogCategory.Area, string.Format("Skipping wave: only %1 unit slots under cap", unitBudget), LogLevel.DEBUG);
             return;
         }
 
-        Print(string.Format("[IA_AreaInstance] Spawning radio tower defense wave: budget %1 units for area %2.", unitBudget, m_area.GetName()), LogLevel.DEBUG);
+        if (IA_Log.IsOn(IA_LogCategory.Area, LogLevel.DEBUG))
+            IA_Log.Write(IA_LogCategory.Area, string.Format("Spawning radio tower defense wave: budget %1 units for area %2.", unitBudget, m_area.GetName()), LogLevel.DEBUG);
         
         // First arg is unit budget when forDefendMission == true
         SpawnReinforcementWave(unitBudget, m_radioTowerDefenseFaction, true);
@@ -5765,9 +5975,21 @@ class IA_AreaInstance
 
         for (int i = 0; i < waveSize; i++)
         {
-            GetGame().GetCallqueue().CallLater(this._SpawnAndArmHostileCivilianGroup_Internal, Math.RandomInt(500, 2000) * (i + 1), false, m_AreaFaction);
+            IA_HostileCivilianSpawnRequest request = new IA_HostileCivilianSpawnRequest();
+            request.m_areaInstance = this;
+            request.m_areaFaction = m_AreaFaction;
+            request.m_priority = IA_SpawnPriority.DefendWave;
+            IA_SpawnQueue.Get().Enqueue(request);
         }
     }
+
+    void SpawnHostileCivilianGroupFromRequest(IA_HostileCivilianSpawnRequest request)
+    {
+        if (!request || !m_area)
+            return;
+
+        _SpawnAndArmHostileCivilianGroup_Internal(request.m_areaFaction);
+    }
     
     private void _SpawnAndArmHostileCivilianGroup_Internal(Faction AreaFaction)
     {
@@ -5854,29 +6076,27 @@ class IA_AreaInstance
 	{
 		if (!m_sideObjectiveDefenseFaction)
 		{
-			Print("[IA_SideObjectiveDefense] Cannot spawn wave, faction is null.", LogLevel.WARNING);
+			if (IA_Log.Allow(IA_LogCategory.Area, "SideObjectiveDefense.NoFaction", 10000, LogLevel.WARNING))
+				IA_Log.Write(IA_LogCategory.Area, "Cannot spawn wave, faction is null.", LogLevel.WARNING);
 			return;
 		}
 	
 		float scaleFactor = IA_Game.GetAIScaleFactor();
 		int unitBudget = IA_GetDefendWaveUnitBudget(scaleFactor);
 
-		int currentAICount = 0;
-		foreach (IA_AiGroup group : m_military)
-		{
-			if (group)
-				currentAICount += group.GetAliveCount();
-		}
+		int currentAICount = m_aliveMilitary;
 		int room = m_sideObjectiveTargetAICount - currentAICount;
 		if (room < unitBudget)
 			unitBudget = room;
 		if (unitBudget < 2)
 		{
-			Print(string.Format("[IA_SideObjectiveDefense] Skipping wave: only %1 unit slots under cap", unitBudget), LogLevel.DEBUG);
+			if (IA_Log.IsOn(IA_LogCategory.Area, LogLevel.DEBUG))
+				IA_Log.Write(IA_LogCategory.Area, string.Format("Skipping wave: only %1 unit slots under cap", unitBudget), LogLevel.DEBUG);
 			return;
 		}
 
-		Print(string.Format("[IA_AreaInstance] Spawning side objective defense wave: budget %1 units for area %2.", unitBudget, m_area.GetName()), LogLevel.DEBUG);
+		if (IA_Log.IsOn(IA_LogCategory.Area, LogLevel.DEBUG))
+			IA_Log.Write(IA_LogCategory.Area, string.Format("Spawning side objective defense wave: budget %1 units for area %2.", unitBudget, m_area.GetName()), LogLevel.DEBUG);
 		
 		// First arg is unit budget when forDefendMission == true
 		SpawnReinforcementWave(unitBudget, m_sideObjectiveDefenseFaction, true);
@@ -5890,17 +6110,15 @@ class IA_AreaInstance
 		int currentTime = System.GetTickCount();
 		if (currentTime - m_sideObjectiveLastWaveSpawnTime >= SIDE_OBJECTIVE_WAVE_INTERVAL)
 		{
-			int currentAICount = 0;
-			foreach (IA_AiGroup group : m_military)
-			{
-				if (group) currentAICount += group.GetAliveCount();
-			}
+			int currentAICount = m_aliveMilitary;
 	
-			Print(string.Format("[IA_AreaInstance] Side Objective Defense Task: Checking AI count for %1. Current: %2, Target: %3.", m_area.GetName(), currentAICount, m_sideObjectiveTargetAICount), LogLevel.DEBUG);
+			if (IA_Log.IsOn(IA_LogCategory.Area, LogLevel.DEBUG))
+				IA_Log.Write(IA_LogCategory.Area, string.Format("Side Objective Defense Task: Checking AI count for %1. Current: %2, Target: %3.", m_area.GetName(), currentAICount, m_sideObjectiveTargetAICount), LogLevel.DEBUG);
 	
 			if (currentAICount < m_sideObjectiveTargetAICount)
 			{
-				Print(string.Format("[IA_AreaInstance] Side Objective Defense Task: AI count low, spawning new wave for %1.", m_area.GetName()), LogLevel.DEBUG);
+				if (IA_Log.IsOn(IA_LogCategory.Area, LogLevel.DEBUG))
+					IA_Log.Write(IA_LogCategory.Area, string.Format("Side Objective Defense Task: AI count low, spawning new wave for %1.", m_area.GetName()), LogLevel.DEBUG);
 				SpawnSideObjectiveDefenseWave();
 			}
 			m_sideObjectiveLastWaveSpawnTime = currentTime;
@@ -22,9 +22,21 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
 	
 	// -- Performance throttling for expensive queries
 	protected float m_fQueryTimeAccumulator = 0.0;
-	protected const float QUERY_INTERVAL = 1.0; // How often to run the expensive sphere query
+	// Sphere query cadence while players are inside or progress is left to decay
+	// (AI move without occupancy events)
+	protected const float QUERY_INTERVAL = 2.0;
+	// Slower cadence for an empty zone with no progress, so US AI alone can still start a capture
+	protected const float IDLE_QUERY_INTERVAL = 5.0;
 	protected int m_iUSCountInZone = 0;
 	protected int m_iUSSRCountInZone = 0;
+	// Scratch counts and callback for UpdatePlayerCountsInZone, reused across queries
+	protected ref IA_DictStringInt m_QueryFactionCounts;
+	protected ref CaptureZoneQueryCallback m_ZoneQueryCallback;
+
+	// -- Player occupancy, maintained by IA_ZoneOccupancyTracker
+	int m_occupancyTickId = 0;
+	protected int m_iPendingPlayers = 0;
+	protected bool m_occupancyChanged = false;
 	protected ref array<IEntity> m_entitiesInZone = new array<IEntity>();
 	
     // -- Sphere radius
@@ -151,6 +163,10 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
 	
     // Static array to hold all pre-placed markers
     static ref array<IA_AreaMarker> s_areaMarkers = new array<IA_AreaMarker>();
+    // Scratch list for allocation-free spatial queries (IA_AreaMarkerIndex)
+    protected static ref array<IA_AreaMarker> s_queryScratch = new array<IA_AreaMarker>();
+    // Dedup stamp used by IA_AreaMarkerIndex.CollectInRadius
+    int m_indexQueryStamp = 0;
     
     // Reset all markers for a new zone group
     static void ResetAllMarkersForNewGroup()
@@ -172,35 +188,22 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
     }
 
     // New static function to retrieve all markers.
+    // Returns the shared registry (nulls pruned in place) - do not modify it.
     static array<IA_AreaMarker> GetAllMarkers()
     {
-        // Create a clean copy of the markers array, removing any null entries
-        array<IA_AreaMarker> validMarkers = {};
-        
         if (!s_areaMarkers)
         {
-            // Print(("[IA_AreaMarker.GetAllMarkers] s_areaMarkers is NULL, initializing empty array", LogLevel.WARNING);
             s_areaMarkers = new array<IA_AreaMarker>();
-            return validMarkers;
+            return s_areaMarkers;
         }
         
-        // Clean up the static array while building the return array
-        for (int i = 0; i < s_areaMarkers.Count(); i++)
+        for (int i = s_areaMarkers.Count() - 1; i >= 0; i--)
         {
-            IA_AreaMarker marker = s_areaMarkers[i];
-            if (!marker)
-            {
-                // Print(("[IA_AreaMarker.GetAllMarkers] Found NULL marker at index " + i + ", removing it", LogLevel.WARNING);
+            if (!s_areaMarkers[i])
                 s_areaMarkers.Remove(i);
-                i--;
-                continue;
-            }
-            
-            validMarkers.Insert(marker);
         }
         
-        // Print(("[DEBUG] GetAllMarkers returning " + validMarkers.Count() + " valid markers of " + s_areaMarkers.Count() + " total", LogLevel.NORMAL);
-        return validMarkers;
+        return s_areaMarkers;
     }
 
     // Attributes to set in the editor
@@ -226,10 +229,18 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
         m_FactionCounts            = new IA_DictStringInt();
         m_CharacterFactionMapping  = new IA_DictIntString();
         m_FactionScores            = new IA_DictStringFloat();
+        m_QueryFactionCounts       = new IA_DictStringInt();
+        m_ZoneQueryCallback        = new CaptureZoneQueryCallback(m_QueryFactionCounts, m_entitiesInZone);
 
         // We want INIT + FRAME events
         SetEventMask(EntityEvent.INIT | EntityEvent.FRAME);
     }
+
+    //----------------------------------------------------------------------------------------------
+    void ~IA_AreaMarker()
+    {
+        IA_AreaMarkerIndex.Remove(this);
+    }
 	
 	
 	//----------------------------------------------------------------------------------------------
@@ -238,40 +249,59 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
 	{
 		// Get all entities within radius
 		m_entitiesInZone.Clear();
-		IA_DictStringInt factionCounts = new IA_DictStringInt();
-		CaptureZoneQueryCallback callback = new CaptureZoneQueryCallback(factionCounts, m_entitiesInZone);
-		GetGame().GetWorld().QueryEntitiesBySphere(m_origin, m_radius, callback.OnEntityFound, null, EQueryEntitiesFlags.DYNAMIC);
+		m_QueryFactionCounts.Clear();
+		GetGame().GetWorld().QueryEntitiesBySphere(m_origin, m_radius, m_ZoneQueryCallback.OnEntityFound, null, EQueryEntitiesFlags.DYNAMIC);
 	
 		// Update the cached counts
-		m_iUSCountInZone = factionCounts.Get("US");
-		m_iUSSRCountInZone = factionCounts.Get("USSR");
+		m_iUSCountInZone = m_QueryFactionCounts.Get("US");
+		m_iUSSRCountInZone = m_QueryFactionCounts.Get("USSR");
 	}
 
 	//------------------------------------------------------------------------------------------------
-	protected int CountPlayersInRadius()
+	//! IA_ZoneOccupancyTracker: start a fresh per-faction count for this tick.
+	void BeginOccupancyTick(int tickId)
 	{
-		PlayerManager pm = GetGame().GetPlayerManager();
-		if (!pm)
-			return 0;
-
-		ref array<int> ids = new array<int>();
-		pm.GetPlayers(ids);
-		int count = ids.Count();
-		if (count <= 0)
-			return 0;
-
-		float radiusSq = m_radius * m_radius;
-		int inside = 0;
-		int i;
-		for (i = 0; i < count; i++)
-		{
-			IEntity pawn = pm.GetPlayerControlledEntity(ids[i]);
-			if (!pawn)
-				continue;
-			if (vector.DistanceSq(pawn.GetOrigin(), m_origin) <= radiusSq)
-				inside = inside + 1;
-		}
-		return inside;
+		m_occupancyTickId = tickId;
+		m_iPendingPlayers = 0;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void AddOccupant()
+	{
+		m_iPendingPlayers++;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Publishes this tick's counts; fires OnOccupancyChanged only if something moved.
+	void CommitOccupancy()
+	{
+		if (m_iPendingPlayers == m_iPlayerCountInZone)
+			return;
+
+		int previousPlayers = m_iPlayerCountInZone;
+		m_iPlayerCountInZone = m_iPendingPlayers;
+		OnOccupancyChanged(previousPlayers, m_iPlayerCountInZone);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	int GetPlayerCountInZone()
+	{
+		return m_iPlayerCountInZone;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Enter / leave event. Re-runs the sphere query to confirm the new faction
+	//! counts (players plus AI); AI left behind in an empty zone still count.
+	protected void OnOccupancyChanged(int previousPlayers, int currentPlayers)
+	{
+		if (IsProxy())
+			return;
+
+		UpdatePlayerCountsInZone();
+		m_fQueryTimeAccumulator = 0;
+
+		if ((previousPlayers > 0) != (currentPlayers > 0))
+			m_occupancyChanged = true;
 	}
 
 	//------------------------------------------------------------------------------------------------
@@ -326,7 +356,15 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
 	        //// Print(("[DEBUG_ZONE_SCORE] Zone " + m_areaName + " (group " + m_areaGroup + ") - Not in active group (" + activeGroup + "), skipping score update", LogLevel.NORMAL);
 	        return;
 	    }
-	    
+
+	    int profileStart = IA_Profiler.Begin();
+	    ActiveGroupFrame(timeSlice);
+	    IA_Profiler.End("AreaMarker.EOnFrame", profileStart, m_areaName);
+	}
+
+	//! Per-frame work for markers in the active group (split out of EOnFrame for profiling).
+	protected void ActiveGroupFrame(float timeSlice)
+	{
 	    // Mortar pits still spawn from the first active-group frame. Radio towers spawn
 	    // from IA_MissionInitializer via EnsureRadioTowersForGroup.
 	    if (!m_prefabSpawned && !m_isDestroyed)
@@ -384,27 +422,29 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
 	        return; // Zone already captured, no need to process
 	    }
 		
-		int playersInZone = CountPlayersInRadius();
-		bool occupancyChanged = false;
-		if (playersInZone > 0 && m_iPlayerCountInZone <= 0)
-		{
-			occupancyChanged = true;
-			UpdatePlayerCountsInZone();
-		}
-		else if (playersInZone <= 0 && m_iPlayerCountInZone > 0)
-		{
-			occupancyChanged = true;
-		}
-		m_iPlayerCountInZone = playersInZone;
+		IA_ZoneOccupancyTracker.Get().Update(m_areaGroup);
+		bool occupancyChanged = m_occupancyChanged;
+		m_occupancyChanged = false;
+
+		// Refresh the AI side of the counts at a slow cadence: AI move without occupancy
+		// events. An empty zone with no progress still polls, more slowly, so US AI alone
+		// can start a capture and USSR AI inside keep decaying progress.
+		bool idle = m_iPlayerCountInZone <= 0 && !m_isCapturing && m_captureProgress <= 0;
+		float queryInterval = QUERY_INTERVAL;
+		if (idle)
+			queryInterval = IDLE_QUERY_INTERVAL;
 
-		// --- Performance: Throttle the expensive entity query ---
 		m_fQueryTimeAccumulator += timeSlice;
-		if (m_fQueryTimeAccumulator >= QUERY_INTERVAL)
+		if (m_fQueryTimeAccumulator >= queryInterval)
 		{
 			UpdatePlayerCountsInZone();
-			m_fQueryTimeAccumulator = Math.Mod(m_fQueryTimeAccumulator, QUERY_INTERVAL);
+			m_fQueryTimeAccumulator = Math.Mod(m_fQueryTimeAccumulator, queryInterval);
 		}
 
+		// Nobody inside, no progress and no US AI seen by the last query: nothing to score.
+		if (idle && !occupancyChanged && m_iUSCountInZone <= 0)
+			return;
+
 	    int usCount = m_iUSCountInZone;
 	    int ussrCount = m_iUSSRCountInZone;
 	    bool wasCapturing = m_isCapturing;
@@ -419,7 +459,7 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
 	    if (usCount == 0 && ussrCount == 0 && m_iPlayerCountInZone <= 0)
 	    {
 	        if (wasCapturing && m_captureProgress > 0 && m_captureProgress < CAPTURE_TIME_SECONDS)
-	            TriggerCaptureNotification("CapturePaused", m_areaName + " capture paused");
+	            TriggerCaptureNotification(IA_NotificationType.CapturePaused, m_areaName + " capture paused");
 
 	        m_IsActive = false;
 	        m_isCapturing = false;
@@ -473,13 +513,13 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
 	        if (!wasCapturing)
 	        {
 	            PublishCaptureHudState(IA_CaptureHudState.Capturing);
-	            TriggerCaptureNotification("CaptureStarted", m_areaName + " capture started");
+	            TriggerCaptureNotification(IA_NotificationType.CaptureStarted, m_areaName + " capture started");
 	        }
 	        
 	        if (!m_hasReached50Percent && m_captureProgress >= CAPTURE_TIME_SECONDS * 0.5)
 	        {
 	            m_hasReached50Percent = true;
-	            TriggerCaptureNotification("Capture50Percent", m_areaName + " 50% captured");
+	            TriggerCaptureNotification(IA_NotificationType.Capture50Percent, m_areaName + " 50% captured");
 	        }
 	    }
 	    else if (ussrCount > usCount)
@@ -494,14 +534,14 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
 	            m_hasReached50Percent = false;
 
 	        if (wasCapturing && m_captureProgress > 0)
-	            TriggerCaptureNotification("CapturePaused", m_areaName + " capture paused");
+	            TriggerCaptureNotification(IA_NotificationType.CapturePaused, m_areaName + " capture paused");
 	    }
 	    else
 	    {
 	        m_isCapturing = false;
 	        m_captureStatus = "Paused";
 	        if (wasCapturing)
-	            TriggerCaptureNotification("CapturePaused", m_areaName + " capture paused");
+	            TriggerCaptureNotification(IA_NotificationType.CapturePaused, m_areaName + " capture paused");
 	    }
 
 	    m_captureProgress = Math.Clamp(m_captureProgress, 0, CAPTURE_TIME_SECONDS);
@@ -575,7 +615,7 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
 	        }
 	        // --- END MODIFIED ---
 	        
-	        TriggerCaptureNotification("TaskCompleted", m_areaName + " Captured!");
+	        TriggerCaptureNotification(IA_NotificationType.TaskCompleted, m_areaName + " Captured!");
 
 	        // Optional mortar pits may be captured after the required AO zones
 	        // complete (including during a defend mission), so complete their
@@ -620,6 +660,7 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
 			s_areaMarkers = new array<IA_AreaMarker>();
 		if (!s_areaMarkers.Contains(this))
 			s_areaMarkers.Insert(this);
+		IA_AreaMarkerIndex.Insert(this);
 		InitCalled = true;
 		super.EOnInit(owner);
 	}
@@ -741,6 +782,7 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
 
         if (Replication.IsServer() && s_areaMarkers && s_areaMarkers.Find(this) == -1)
             s_areaMarkers.Insert(this);
+        IA_AreaMarkerIndex.Reindex(this);
 
         Print(string.Format("[IA_AreaMarker] ConfigureRuntime MortarPit '%1' group %2 count %3 at %4", m_areaName, m_areaGroup, m_mortarCount, m_origin), LogLevel.NORMAL);
     }
@@ -808,7 +850,7 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
 
     static IA_AreaMarker GetMortarPitMarkerForGroup(int groupNumber)
     {
-        foreach (IA_AreaMarker marker : s_areaMarkers)
+        foreach (IA_AreaMarker marker : IA_AreaMarkerIndex.GetGroupMarkers(groupNumber))
         {
             if (!marker)
                 continue;
@@ -942,21 +984,10 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
         return false;
     }
 
-    // Get all markers for a specific group
+    // Get all markers for a specific group (shared bucket from IA_AreaMarkerIndex - do not modify)
     static array<IA_AreaMarker> GetAreaMarkersByGroup(int groupNumber)
     {
-        array<IA_AreaMarker> groupMarkers = {};
-        
-        foreach (IA_AreaMarker marker : s_areaMarkers)
-        {
-            if (!marker)
-                continue;
-                
-            if (marker.m_areaGroup == groupNumber)
-                groupMarkers.Insert(marker);
-        }
-        
-        return groupMarkers;
+        return IA_AreaMarkerIndex.GetGroupMarkers(groupNumber);
     }
     
     // Get all zone origins for a specific group
@@ -1022,16 +1053,7 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
     // Helper to find a marker at a specific position
     static IA_AreaMarker GetMarkerAtPosition(vector position)
     {
-        foreach (IA_AreaMarker marker : s_areaMarkers)
-        {
-            if (!marker)
-                continue;
-                
-            if (marker.GetOrigin() == position)
-                return marker;
-        }
-        
-        return null;
+        return IA_AreaMarkerIndex.FindByOrigin(position);
     }
 
     // Spawn the radio-tower composition (replicated GenericEntity root + tower child).
@@ -1151,6 +1173,7 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
         {
             m_radius = neededRadius;
             m_fZoneRadius = neededRadius;
+            IA_AreaMarkerIndex.Reindex(this);
         }
 
         ResourceName pitPrefab = m_prefabToSpawn;
@@ -1542,7 +1565,7 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
         // Notify players that the objective is complete and waves have stopped
         IA_MissionInitializer initializer = IA_MissionInitializer.GetInstance();
         if (initializer)
-            initializer.TriggerGlobalNotification("TaskCompleted", "Radio Tower " + m_areaName + " Destroyed. Reinforcements halted. QRF disabled for 10 minutes.");
+            initializer.TriggerGlobalNotification(IA_NotificationType.TaskCompleted, "Radio Tower " + m_areaName + " Destroyed. Reinforcements halted. QRF disabled for 10 minutes.");
         // --- END MODIFIED ---
 
         // Set the US faction score to 1000 (maximum) to indicate completion
@@ -1578,23 +1601,12 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
 		pawn.GetWorldTransform(mat);
 		vector pos = mat[3];
 
-		array<IA_AreaMarker> markers = GetAllMarkers();
-		int count = markers.Count();
+		s_queryScratch.Clear();
+		int count = IA_AreaMarkerIndex.CollectContaining(pos, s_queryScratch, true);
 		int i;
 		for (i = 0; i < count; i++)
 		{
-			IA_AreaMarker marker = markers[i];
-			if (!marker)
-				continue;
-
-			IA_AreaType areaType = marker.GetAreaType();
-			if (areaType == IA_AreaType.RadioTower)
-				continue;
-			if (areaType == IA_AreaType.DefendObjective)
-				continue;
-			if (!marker.IsPositionInside(pos))
-				continue;
-
+			IA_AreaMarker marker = s_queryScratch[i];
 			string areaName = marker.GetAreaName();
 			if (areaName.IsEmpty())
 				continue;
@@ -1721,6 +1733,7 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
         m_captureStatus = "Neutral";
         m_fHudPublishAcc = 0;
         m_iPlayerCountInZone = 0;
+        m_occupancyChanged = false;
         IA_MissionInitializer.PublishCaptureHud(m_areaName, IA_CaptureHudState.Hidden, 0);
     }
 
@@ -1733,22 +1746,9 @@ class IA_AreaMarker : ScriptedGameTriggerEntity
     }
     
     // Trigger notification to all players
-    void TriggerCaptureNotification(string messageType, string message)
+    void TriggerCaptureNotification(IA_NotificationType type, string message)
     {
-        array<int> playerIDs = new array<int>();
-        GetGame().GetPlayerManager().GetAllPlayers(playerIDs);
-        foreach (int playerID : playerIDs)
-        {
-            PlayerController pc = GetGame().GetPlayerManager().GetPlayerController(playerID);
-            if (pc)
-            {
-                SCR_ChimeraCharacter character = SCR_ChimeraCharacter.Cast(pc.GetControlledEntity());
-                if (character)
-                {
-                    character.SetUIOne(messageType, message, playerID);
-                }
-            }
-        }
+        IA_NotificationReplicatorComponent.NotifyAll(type, message);
     }
     
     // Get capture progress percentage
@@ -1853,24 +1853,7 @@ class ZoneChecker
 
 	int CheckPlayersInZone()
 	{
-		int numberOfPlayersInZone = 0;
-		array<int> playerIds = {};
-		m_playerManager.GetAllPlayers(playerIds);
-		foreach (int playerId : playerIds)
-		{
-			IEntity playerEntity = m_playerManager.GetPlayerControlledEntity(playerId);
-			if (!playerEntity)
-				continue;
-
-			if (IsPlayerInZone(playerEntity))
-			{
-				//// Print(("Player " + playerId + " is inside the zone.");
-				numberOfPlayersInZone++;
-			}
-		}
-		//GetGame().GetWorld().Get("IA_MissionInitializer")
-		//game.getActiveArea();
-		return numberOfPlayersInZone;
+		return IA_PlayerSnapshot.Get().CountInRadius(m_zoneCenter, m_zoneRadius);
 	}
 
 	bool IsPlayerInZone(IEntity player)
@@ -0,0 +1,232 @@
+///////////////////////////////////////////////////////////////////////
+// IA_AreaMarkerIndex - uniform grid over area marker circles
+///////////////////////////////////////////////////////////////////////
+
+//! Static spatial index for IA_AreaMarker. Markers add themselves in EOnInit
+//! (and again if their radius or group changes). Each marker is stored in
+//! every cell its circle overlaps, plus a per-group bucket, so point and
+//! radius lookups only touch the markers near the query.
+//! Query results go into caller-owned arrays; nothing is allocated per query.
+class IA_AreaMarkerIndex
+{
+	static const float CELL_SIZE_M = 500.0;
+	// Cell coords are offset so negative positions still map to unique keys.
+	protected static const int CELL_OFFSET = 2048;
+	protected static const int CELL_STRIDE = 4096;
+
+	protected static ref map<int, ref array<IA_AreaMarker>> s_cells = new map<int, ref array<IA_AreaMarker>>();
+	protected static ref map<int, ref array<IA_AreaMarker>> s_groups = new map<int, ref array<IA_AreaMarker>>();
+	protected static ref array<IA_AreaMarker> s_empty = {};
+
+	// Bumped per radius query so a marker spanning several cells is reported once.
+	protected static int s_queryStamp = 0;
+
+	//------------------------------------------------------------------------------------------------
+	protected static int CellCoord(float v)
+	{
+		return (int)Math.Floor(v / CELL_SIZE_M);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static int CellKey(int cx, int cz)
+	{
+		return ((cx + CELL_OFFSET) * CELL_STRIDE) + (cz + CELL_OFFSET);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static void Insert(IA_AreaMarker marker)
+	{
+		if (!marker)
+			return;
+
+		vector origin = marker.GetOrigin();
+		float radius = marker.GetRadius();
+
+		int minX = CellCoord(origin[0] - radius);
+		int maxX = CellCoord(origin[0] + radius);
+		int minZ = CellCoord(origin[2] - radius);
+		int maxZ = CellCoord(origin[2] + radius);
+
+		for (int cx = minX; cx <= maxX; cx++)
+		{
+			for (int cz = minZ; cz <= maxZ; cz++)
+			{
+				int key = CellKey(cx, cz);
+				array<IA_AreaMarker> cell = s_cells.Get(key);
+				if (!cell)
+				{
+					cell = new array<IA_AreaMarker>();
+					s_cells.Insert(key, cell);
+				}
+				if (cell.Find(marker) == -1)
+					cell.Insert(marker);
+			}
+		}
+
+		array<IA_AreaMarker> group = s_groups.Get(marker.m_areaGroup);
+		if (!group)
+		{
+			group = new array<IA_AreaMarker>();
+			s_groups.Insert(marker.m_areaGroup, group);
+		}
+		if (group.Find(marker) == -1)
+			group.Insert(marker);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Removal is rare (runtime mortar pits, deletion), so it just sweeps all buckets.
+	static void Remove(IA_AreaMarker marker)
+	{
+		if (!marker)
+			return;
+
+		foreach (int key, array<IA_AreaMarker> cell : s_cells)
+		{
+			cell.RemoveItem(marker);
+		}
+		foreach (int groupId, array<IA_AreaMarker> group : s_groups)
+		{
+			group.RemoveItem(marker);
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static void Reindex(IA_AreaMarker marker)
+	{
+		Remove(marker);
+		Insert(marker);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static void Clear()
+	{
+		s_cells.Clear();
+		s_groups.Clear();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Markers of one area group. Shared array - do not modify.
+	static array<IA_AreaMarker> GetGroupMarkers(int groupNumber)
+	{
+		array<IA_AreaMarker> group = s_groups.Get(groupNumber);
+		if (!group)
+			return s_empty;
+		return group;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Markers registered in the cell containing `pos`. Shared array - do not modify. May be null.
+	static array<IA_AreaMarker> GetCellMarkers(vector pos)
+	{
+		return s_cells.Get(CellKey(CellCoord(pos[0]), CellCoord(pos[2])));
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! First marker whose circle contains `pos`, or null.
+	static IA_AreaMarker FindContaining(vector pos, bool capturableOnly = false)
+	{
+		array<IA_AreaMarker> cell = GetCellMarkers(pos);
+		if (!cell)
+			return null;
+
+		int count = cell.Count();
+		for (int i = 0; i < count; i++)
+		{
+			IA_AreaMarker marker = cell[i];
+			if (!marker || !marker.IsPositionInside(pos))
+				continue;
+			if (capturableOnly && !IsCapturable(marker))
+				continue;
+			return marker;
+		}
+		return null;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Appends every marker whose circle contains `pos`. Returns how many were added.
+	static int CollectContaining(vector pos, notnull array<IA_AreaMarker> outMarkers, bool capturableOnly = false)
+	{
+		array<IA_AreaMarker> cell = GetCellMarkers(pos);
+		if (!cell)
+			return 0;
+
+		int added = 0;
+		int count = cell.Count();
+		for (int i = 0; i < count; i++)
+		{
+			IA_AreaMarker marker = cell[i];
+			if (!marker || !marker.IsPositionInside(pos))
+				continue;
+			if (capturableOnly && !IsCapturable(marker))
+				continue;
+			outMarkers.Insert(marker);
+			added++;
+		}
+		return added;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Appends every marker whose circle overlaps the circle (`pos`, `radius`).
+	static int CollectInRadius(vector pos, float radius, notnull array<IA_AreaMarker> outMarkers)
+	{
+		s_queryStamp++;
+
+		int minX = CellCoord(pos[0] - radius);
+		int maxX = CellCoord(pos[0] + radius);
+		int minZ = CellCoord(pos[2] - radius);
+		int maxZ = CellCoord(pos[2] + radius);
+
+		int added = 0;
+		for (int cx = minX; cx <= maxX; cx++)
+		{
+			for (int cz = minZ; cz <= maxZ; cz++)
+			{
+				array<IA_AreaMarker> cell = s_cells.Get(CellKey(cx, cz));
+				if (!cell)
+					continue;
+
+				int count = cell.Count();
+				for (int i = 0; i < count; i++)
+				{
+					IA_AreaMarker marker = cell[i];
+					if (!marker || marker.m_indexQueryStamp == s_queryStamp)
+						continue;
+					marker.m_indexQueryStamp = s_queryStamp;
+
+					float reach = radius + marker.GetRadius();
+					if (vector.DistanceSq(pos, marker.GetOrigin()) > reach * reach)
+						continue;
+
+					outMarkers.Insert(marker);
+					added++;
+				}
+			}
+		}
+		return added;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Marker whose origin is exactly `pos` (origins are unique per marker).
+	static IA_AreaMarker FindByOrigin(vector pos)
+	{
+		array<IA_AreaMarker> cell = GetCellMarkers(pos);
+		if (!cell)
+			return null;
+
+		int count = cell.Count();
+		for (int i = 0; i < count; i++)
+		{
+			IA_AreaMarker marker = cell[i];
+			if (marker && marker.GetOrigin() == pos)
+				return marker;
+		}
+		return null;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static bool IsCapturable(IA_AreaMarker marker)
+	{
+		IA_AreaType areaType = marker.GetAreaType();
+		return areaType != IA_AreaType.RadioTower && areaType != IA_AreaType.DefendObjective;
+	}
+};
@@ -26,25 +26,6 @@ modded class SCR_ChimeraCharacter{
 		}
 	}
 	
-	void SetUIOne(string messageType, string taskTitle, int playerId){
-		//IA_ReplicationWorkaround rep = IA_ReplicationWorkaround.Instance();
-		//rep.TriggerGlobalNotificationFinal(messageType, taskTitle, playerId);
-		
-		if(!Replication.IsServer()){
-						Do_TriggerSetUIOneHandler(messageType, taskTitle, playerId);
-
-			Print("Running As Client",LogLevel.NORMAL);
-			
-		} else{
-						Rpc(RpcDo_TriggerSetUIOneHandler, messageType, taskTitle, playerId);
-						Do_TriggerSetUIOneHandler(messageType, taskTitle, playerId);
-
-			Print("Running As Server",LogLevel.NORMAL);
-		}
-		
-			
-	
-	}
 	/*
 	void Do_TriggerSetUIOneHandler(string messageType, string taskTitle, int playerId){
 		//Print("Running Do_TriggerSetUIOneHandler for "+ messageType + " And " + taskTitle,LogLevel.NORMAL);
@@ -93,128 +74,6 @@ modded class SCR_ChimeraCharacter{
 	}
 	*/
 	
-	void Do_TriggerSetUIOneHandler(string messageType, string taskTitle, int playerId){
-		//Print("Running Do_TriggerSetUIOneHandler for "+ messageType + " And " + taskTitle,LogLevel.NORMAL);
-		PlayerController pc = GetGame().GetPlayerManager().GetPlayerController(playerId);
-		if(!pc)
-			return;
-		SCR_HUDManagerComponent displayManager = SCR_HUDManagerComponent.Cast(pc.FindComponent(SCR_HUDManagerComponent)); 
-
-			if (!displayManager)
-				return;
-		//Print("Running Do_TriggerSetUIOneHandler",LogLevel.NORMAL);
-			IA_NotificationDisplay notificationDisplay = IA_NotificationDisplay.Cast(displayManager.FindInfoDisplay(IA_NotificationDisplay));
-			
-			if (!notificationDisplay)
-			{
-							
-					Print("notificationDisplay is NULL", LogLevel.ERROR);
-				
-			}
-
-			if (notificationDisplay)
-			{
-				if (messageType == "TaskCreated")
-				{
-					GetGame().GetCallqueue().CallLater(notificationDisplay.DisplayTaskCreatedNotification, 100, false, taskTitle);
-				}else if (messageType == "AreaGroupCompleted")
-			{
-				GetGame().GetCallqueue().CallLater(notificationDisplay.DisplayAreaCompletedNotification, 100, false, taskTitle); 
-			}else if (messageType == "AoTopContributors")
-			{
-				GetGame().GetCallqueue().CallLater(notificationDisplay.DisplayAoTopContributorsNotification, 100, false, taskTitle);
-			}else if (messageType == "SideTaskCreated")
-			{
-
-				GetGame().GetCallqueue().CallLater(notificationDisplay.DisplaySideTaskCreatedNotification, 100, false, taskTitle); 
-			}else if (messageType == "HVTEscaping")
-			{
-				notificationDisplay.QueueNotification(taskTitle, "red", 10000);
-
-			
-			}else if (messageType == "SideTaskCompleted")
-			{
-				notificationDisplay.QueueNotification(taskTitle, "green", 12000);
-
-			}
-			else if (messageType == "TaskCompleted")
-			{
-				GetGame().GetCallqueue().CallLater(notificationDisplay.DisplayTaskCompletedNotification, 100, false, taskTitle); 
-			}else if (messageType == "RadioTowerDefenseStarted")
-			{
-				string message = "Enemy reinforcements are responding! Destroy the "+taskTitle+" to prevent their continuous reinforcements.";
-				notificationDisplay.QueueNotification(message, "yellow", 10000);
-			}else if (messageType == "DefendMissionStarted")
-				{
-					notificationDisplay.DisplayTaskCreatedNotification(taskTitle);
-				}
-				else if (messageType == "CivilianRevoltStarted")
-				{
-					string message = "The civilian population is revolting! Be advised, they are now hostile.";
-					notificationDisplay.QueueNotification(message, "red", 10000);
-				}
-				else if (messageType == "CivilianRevoltReinforcements")
-				{
-					string message = "Civilian militias are reinforcing the objective areas!";
-					notificationDisplay.QueueNotification(message, "red", 10000);
-				}
-				else if (messageType == "CaptureStarted")
-				{
-					if (!notificationDisplay.IsCaptureHudActive())
-					{
-						notificationDisplay.QueueNotification(taskTitle, "green", 5000);
-					}
-				}
-				else if (messageType == "CapturePaused")
-				{
-					if (!notificationDisplay.IsCaptureHudActive())
-					{
-						notificationDisplay.QueueNotification(taskTitle, "yellow", 5000);
-					}
-				}
-				else if (messageType == "Capture50Percent")
-				{
-					if (!notificationDisplay.IsCaptureHudActive())
-					{
-						notificationDisplay.QueueNotification(taskTitle, "green", 5000);
-					}
-				}
-				else if (messageType == "GeneratorDestroyed")
-				{
-					notificationDisplay.QueueNotification(taskTitle, "green", 10000);
-				}
-				else if (messageType == "ReinforcementsCalled")
-				{
-					notificationDisplay.QueueNotification(taskTitle, "red", 10000);
-				}
-				else if (messageType == "HVTPreparingEscape")
-				{
-					// taskTitle typically is "Intercept HVT" but treat generically
-					notificationDisplay.QueueNotification(taskTitle, "red", 10000);
-				}
-				else if (messageType == "HVTEscaped")
-				{
-					notificationDisplay.QueueNotification(taskTitle, "red", 10000);
-				}
-			
-			
-			
-				// Optional: Auto-hide after a few seconds
-				// GetGame().GetCallqueue().CallLater(notificationDisplay.HideNotification, 5000, false);
-			}
-			else
-			{
-				Print(string.Format("[IA_AreaInstance] Could not find or create IA_NotificationDisplay for player."), LogLevel.WARNING);
-			}
-	
-	}
-	
-	
-	
-	[RplRpc(RplChannel.Reliable, RplRcver.Broadcast)]
-	void RpcDo_TriggerSetUIOneHandler(string messageType, string taskTitle, int playerId){
-		Do_TriggerSetUIOneHandler(messageType, taskTitle, playerId);
-	}
 /*	
 	[RplRpc(RplChannel.Reliable, RplRcver.Broadcast)]
 	void RpcDo_TriggerSetUIOne(string messageType, string taskTitle){
@@ -51,6 +51,9 @@ class IA_Config{
 
 	[Attribute(defvalue: "1.0", UIWidgets.EditBox, category: "AI Scaling", desc: "Multiplier for military vehicle count calculation (0.5 = half, 2.0 = double)")]
 	float m_fMilitaryVehicleCountMultiplier;
+
+	[Attribute(defvalue: "1500", UIWidgets.EditBox, category: "AI Scaling", desc: "Infantry groups farther than this (m) from every player are virtualized until a player comes within it again minus 300 m. 0 disables.")]
+	float m_fAIVirtualizeDistance = 1500;
  
 	[Attribute(defvalue: "false", UIWidgets.CheckBox, category: "Roles", desc: "Enforce role restrictions for vehicle pilots.")]
 	bool m_bEnforceRoleRestrictions;
@@ -90,6 +93,12 @@ class IA_Config{
 	[Attribute(defvalue: "70", UIWidgets.EditBox, category: "Artillery", desc: "Maximum delay (in seconds) from smoke to impact")]
 	int m_iArtilleryMaxDelay;
 
+	[Attribute(defvalue: "131", uiwidget: UIWidgets.Flags, enums: ParamEnumArray.FromEnum(IA_LogCategory), category: "Logging", desc: "Log categories written to the console and log ring. Warnings and errors are always written.")]
+	IA_LogCategory m_eLogCategories = IA_LogCategory.General | IA_LogCategory.Area | IA_LogCategory.Capture;
+
+	[Attribute(defvalue: "true", UIWidgets.CheckBox, category: "Logging", desc: "Print enabled log categories to the console. When off they only go to the in-memory ring (dump from the admin menu).")]
+	bool m_bLogToConsole = true;
+
  
  // No Getter methods. We reference the variables directly. 
  // Config access is handled through IA_MissionInitializer.GetGlobalConfig()
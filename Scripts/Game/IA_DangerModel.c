@@ -0,0 +1,162 @@
+///////////////////////////////////////////////////////////////////////
+// IA_DangerModel - per-group danger level and threat position
+///////////////////////////////////////////////////////////////////////
+
+//! Recent danger events of one infantry group, kept in a fixed ring of parallel
+//! arrays (position, weight, time, positional flag) allocated once. Record() is O(1)
+//! and allocation-free:
+//!  - the level is a sum of event weights decaying with time constant DECAY_TAU_S,
+//!    stored as (value, time) and decayed on demand;
+//!  - the threat position is a streaming per-axis median. Each axis steps toward
+//!    the new sample by at most a fraction of its running mean absolute deviation,
+//!    so a stray shot nudges it and sustained fire from a new spot drags it over.
+//! Only weapon fire, explosions and spotted enemies move the position; impacts and
+//! flybys only add danger. Events older than WINDOW_MS no longer count.
+class IA_DangerModel
+{
+	static const int CAPACITY = 32;
+	static const int WINDOW_MS = 30000;
+	// 15 s gives an event the same total weight as the old linear 30 s ramp.
+	static const float DECAY_TAU_S = 15.0;
+	static const float MEDIAN_STEP_FRACTION = 0.5;
+	static const float MEDIAN_MIN_STEP_M = 1.0;
+	static const float SPREAD_RATE = 0.2;
+	static const float SEED_SPREAD_M = 10.0;
+
+	protected ref array<vector> m_positions = {};
+	protected ref array<float> m_weights = {};
+	protected ref array<int> m_timesMs = {};
+	protected ref array<bool> m_positional = {};
+	protected int m_head;
+	protected int m_count;
+
+	protected float m_level;
+	protected int m_levelMs;
+	protected int m_lastEventMs;
+
+	protected bool m_hasMedian;
+	protected vector m_median;
+	protected vector m_spread;
+	protected int m_lastPositionalMs;
+
+	//------------------------------------------------------------------------------------------------
+	void IA_DangerModel()
+	{
+		m_positions.Resize(CAPACITY);
+		m_weights.Resize(CAPACITY);
+		m_timesMs.Resize(CAPACITY);
+		m_positional.Resize(CAPACITY);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void Record(vector position, float weight, bool positional, int nowMs)
+	{
+		m_positions[m_head] = position;
+		m_weights[m_head] = weight;
+		m_timesMs[m_head] = nowMs;
+		m_positional[m_head] = positional;
+		m_head = (m_head + 1) % CAPACITY;
+		if (m_count < CAPACITY)
+			m_count++;
+
+		m_level = DecayedLevel(nowMs) + weight;
+		m_levelMs = nowMs;
+		m_lastEventMs = nowMs;
+
+		if (positional)
+			UpdateMedian(position, nowMs);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void Clear()
+	{
+		m_head = 0;
+		m_count = 0;
+		m_level = 0;
+		m_levelMs = 0;
+		m_lastEventMs = 0;
+		m_hasMedian = false;
+		m_lastPositionalMs = 0;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! True if any event is younger than WINDOW_MS.
+	bool HasRecent(int nowMs)
+	{
+		return m_count > 0 && nowMs - m_lastEventMs <= WINDOW_MS;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Decayed danger, capped at 1.
+	float GetLevel(int nowMs)
+	{
+		if (!HasRecent(nowMs))
+			return 0;
+		return Math.Clamp(DecayedLevel(nowMs), 0.0, 1.0);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Median threat position, or vector.Zero if no positional event is within the window.
+	vector GetMedianPosition(int nowMs)
+	{
+		if (!m_hasMedian || nowMs - m_lastPositionalMs > WINDOW_MS)
+			return vector.Zero;
+		return m_median;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Appends positional events within the window, newest first. Returns how many were added.
+	int GetRecentPositions(notnull array<vector> outPositions, int nowMs)
+	{
+		int added = 0;
+		for (int n = 0; n < m_count; n++)
+		{
+			int slot = (m_head - 1 - n + CAPACITY) % CAPACITY;
+			// Ring is in time order, so everything after the first stale slot is stale too.
+			if (nowMs - m_timesMs[slot] > WINDOW_MS)
+				break;
+			if (!m_positional[slot])
+				continue;
+
+			outPositions.Insert(m_positions[slot]);
+			added++;
+		}
+		return added;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected float DecayedLevel(int nowMs)
+	{
+		if (m_level <= 0)
+			return 0;
+		float ageS = (nowMs - m_levelMs) / 1000.0;
+		return m_level * Math.Pow(Math.E, -ageS / DECAY_TAU_S);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void UpdateMedian(vector position, int nowMs)
+	{
+		// After a quiet window the old estimate says nothing about the new contact.
+		if (!m_hasMedian || nowMs - m_lastPositionalMs > WINDOW_MS)
+		{
+			m_median = position;
+			m_spread = Vector(SEED_SPREAD_M, SEED_SPREAD_M, SEED_SPREAD_M);
+			m_hasMedian = true;
+			m_lastPositionalMs = nowMs;
+			return;
+		}
+
+		vector median = m_median;
+		vector spread = m_spread;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			float delta = position[axis] - median[axis];
+			float step = Math.Max(spread[axis] * MEDIAN_STEP_FRACTION, MEDIAN_MIN_STEP_M);
+			median[axis] = median[axis] + Math.Clamp(delta, -step, step);
+			spread[axis] = spread[axis] + SPREAD_RATE * (Math.AbsFloat(delta) - spread[axis]);
+		}
+		m_median = median;
+		m_spread = spread;
+		m_lastPositionalMs = nowMs;
+	}
+};
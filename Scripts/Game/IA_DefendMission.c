@@ -162,7 +162,7 @@ class IA_DefendMission
                 taskTitle = "Defend Position";
             else
                 taskTitle = "Defend " + m_defendMarkerName;
-            initializer.TriggerGlobalNotification("TaskCompleted", taskTitle);
+            initializer.TriggerGlobalNotification(IA_NotificationType.TaskCompleted, taskTitle);
         }
         
         // Return all AI to normal mode
@@ -522,7 +522,8 @@ class IA_DefendMission
             array<ref IA_AiGroup> militaryGroups = area.GetMilitaryGroups();
             foreach (IA_AiGroup group : militaryGroups)
             {
-                if (group && group.IsSpawned() && group.GetAliveCount() > 0)
+                // Virtualized groups only record it; they come back in defend mode.
+                if (group && (group.IsSpawned() || group.IsVirtualized()) && group.GetAliveCount() > 0)
                 {
                     Print(string.Format("[IA_DefendMission] Setting defend mode for existing group at %1", group.GetOrigin().ToString()), LogLevel.NORMAL);
                     // This will give them SearchAndDestroy orders on the defend point and set them to authority-managed
@@ -659,16 +660,7 @@ class IA_DefendMission
         foreach (IA_AreaInstance area : m_affectedAreas)
         {
             if (area)
-            {
-                array<ref IA_AiGroup> militaryGroups = area.GetMilitaryGroups();
-                foreach (IA_AiGroup group : militaryGroups)
-                {
-                    if (group && group.IsSpawned() && group.IsDefendWaveGroup())
-                    {
-                        totalAI += group.GetAliveCount();
-                    }
-                }
-            }
+                totalAI += area.GetAliveSpawnedDefendWaveCount();
         }
         
         return totalAI;
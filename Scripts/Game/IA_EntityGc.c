@@ -0,0 +1,287 @@
+///////////////////////////////////////////////////////////////////////
+// IA_EntityGc - batched, rate-limited entity deletion
+///////////////////////////////////////////////////////////////////////
+
+//! Deletion order; lower drains first. Vehicles cost the most to keep
+//! simulated and replicated, corpses the least.
+enum IA_GcPriority
+{
+	Vehicle,
+	Misc,
+	Character
+};
+
+//! Growable FIFO ring of entities. Entities are Managed, so an entry that
+//! was deleted elsewhere simply reads back as null.
+class IA_EntityRing
+{
+	private ref array<IEntity> m_items = {};
+	private ref array<int> m_deferrals = {};
+	private int m_head = 0;
+	private int m_count = 0;
+
+	void IA_EntityRing(int capacity = 64)
+	{
+		m_items.Resize(capacity);
+		m_deferrals.Resize(capacity);
+	}
+
+	int Count()
+	{
+		return m_count;
+	}
+
+	bool IsEmpty()
+	{
+		return m_count == 0;
+	}
+
+	void Push(IEntity e, int deferrals = 0)
+	{
+		int capacity = m_items.Count();
+		if (m_count == capacity)
+			Grow(capacity * 2);
+
+		int tail = (m_head + m_count) % m_items.Count();
+		m_items[tail] = e;
+		m_deferrals[tail] = deferrals;
+		m_count++;
+	}
+
+	IEntity Pop(out int deferrals)
+	{
+		deferrals = 0;
+		if (m_count == 0)
+			return null;
+
+		IEntity e = m_items[m_head];
+		deferrals = m_deferrals[m_head];
+		m_items[m_head] = null;
+		m_head = (m_head + 1) % m_items.Count();
+		m_count--;
+		return e;
+	}
+
+	void Clear()
+	{
+		int capacity = m_items.Count();
+		for (int i = 0; i < capacity; i++)
+		{
+			m_items[i] = null;
+		}
+		m_head = 0;
+		m_count = 0;
+	}
+
+	private void Grow(int newCapacity)
+	{
+		array<IEntity> items = {};
+		array<int> deferrals = {};
+		items.Resize(newCapacity);
+		deferrals.Resize(newCapacity);
+
+		int capacity = m_items.Count();
+		for (int i = 0; i < m_count; i++)
+		{
+			int src = (m_head + i) % capacity;
+			items[i] = m_items[src];
+			deferrals[i] = m_deferrals[src];
+		}
+
+		m_items = items;
+		m_deferrals = deferrals;
+		m_head = 0;
+	}
+}
+
+//! Replaces the one-entity-per-500ms queue. Each tick deletes a batch sized
+//! to the backlog, vehicles first. Vehicles and corpses close to a player go
+//! back to the end of their queue a few times before they are deleted anyway.
+class IA_EntityGc
+{
+	static const int TICK_MS = 250;
+	static const int MIN_DELETES_PER_TICK = 1;
+	static const int MAX_DELETES_PER_TICK = 24;
+	// Aim to clear any backlog within ~10s of ticks
+	static const int TARGET_DRAIN_TICKS = 40;
+	static const int TICK_TIME_BUDGET_MS = 2;
+	static const float NEAR_PLAYER_M = 150.0;
+	static const int MAX_NEAR_DEFERRALS = 8;
+
+	private ref array<ref IA_EntityRing> m_queues = {};
+	private array<vector> m_playerPositions;
+	private bool m_running = false;
+
+	// Counters
+	private int m_totalQueued = 0;
+	private int m_totalDeleted = 0;
+	private int m_deletedLastTick = 0;
+	private float m_drainRatePerSec = 0;
+
+	void IA_EntityGc()
+	{
+		m_queues.Insert(new IA_EntityRing());
+		m_queues.Insert(new IA_EntityRing());
+		m_queues.Insert(new IA_EntityRing(256));
+	}
+
+	void ~IA_EntityGc()
+	{
+		Stop();
+	}
+
+	void Start()
+	{
+		if (m_running)
+			return;
+		m_running = true;
+		GetGame().GetCallqueue().CallLater(Tick, TICK_MS, true);
+	}
+
+	void Stop()
+	{
+		if (!m_running)
+			return;
+		m_running = false;
+		GetGame().GetCallqueue().Remove(Tick);
+	}
+
+	void Add(IEntity e)
+	{
+		if (!e)
+			return;
+		m_queues[Classify(e)].Push(e);
+		m_totalQueued++;
+	}
+
+	void Clear()
+	{
+		foreach (IA_EntityRing ring : m_queues)
+		{
+			ring.Clear();
+		}
+	}
+
+	int GetQueueDepth()
+	{
+		int depth = 0;
+		foreach (IA_EntityRing ring : m_queues)
+		{
+			depth += ring.Count();
+		}
+		return depth;
+	}
+
+	int GetQueueDepthFor(IA_GcPriority priority)
+	{
+		return m_queues[priority].Count();
+	}
+
+	int GetTotalQueued()
+	{
+		return m_totalQueued;
+	}
+
+	int GetTotalDeleted()
+	{
+		return m_totalDeleted;
+	}
+
+	int GetDeletedLastTick()
+	{
+		return m_deletedLastTick;
+	}
+
+	//! Smoothed deletions per second.
+	float GetDrainRate()
+	{
+		return m_drainRatePerSec;
+	}
+
+	static IA_GcPriority Classify(IEntity e)
+	{
+		if (Vehicle.Cast(e))
+			return IA_GcPriority.Vehicle;
+		if (ChimeraCharacter.Cast(e))
+			return IA_GcPriority.Character;
+		return IA_GcPriority.Misc;
+	}
+
+	private int ComputeBudget(int depth)
+	{
+		int budget = (int)Math.Ceil(depth / (float)TARGET_DRAIN_TICKS);
+		return Math.ClampInt(budget, MIN_DELETES_PER_TICK, MAX_DELETES_PER_TICK);
+	}
+
+	private bool IsNearPlayer(IEntity e)
+	{
+		if (!m_playerPositions || m_playerPositions.IsEmpty())
+			return false;
+
+		vector pos = e.GetOrigin();
+		float nearSq = NEAR_PLAYER_M * NEAR_PLAYER_M;
+		int playerCount = m_playerPositions.Count();
+		for (int i = 0; i < playerCount; i++)
+		{
+			if (vector.DistanceSq(pos, m_playerPositions[i]) < nearSq)
+				return true;
+		}
+		return false;
+	}
+
+	private void Tick()
+	{
+		int depth = GetQueueDepth();
+		m_deletedLastTick = 0;
+		if (depth == 0)
+		{
+			m_drainRatePerSec = m_drainRatePerSec * 0.8;
+			return;
+		}
+
+		m_playerPositions = IA_PlayerSnapshot.Get().GetLivePositions();
+
+		int budget = ComputeBudget(depth);
+		int tickStart = System.GetTickCount();
+		int deleted = 0;
+
+		int queueCount = m_queues.Count();
+		for (int p = 0; p < queueCount; p++)
+		{
+			IA_EntityRing ring = m_queues[p];
+			// Waypoints and task entities are invisible; only hide vehicle and corpse deletions.
+			bool canDefer = (p != IA_GcPriority.Misc);
+
+			// Each entry is looked at most once per tick, so deferred ones can't spin.
+			int toVisit = ring.Count();
+			while (toVisit > 0 && deleted < budget)
+			{
+				if (System.GetTickCount() - tickStart > TICK_TIME_BUDGET_MS)
+					break;
+
+				toVisit--;
+				int deferrals;
+				IEntity e = ring.Pop(deferrals);
+				if (!e)
+					continue; // Already gone
+
+				if (canDefer && deferrals < MAX_NEAR_DEFERRALS && IsNearPlayer(e))
+				{
+					ring.Push(e, deferrals + 1);
+					continue;
+				}
+
+				delete e;
+				deleted++;
+			}
+
+			if (deleted >= budget)
+				break;
+		}
+
+		m_deletedLastTick = deleted;
+		m_totalDeleted += deleted;
+		float instantRate = deleted * (1000.0 / TICK_MS);
+		m_drainRatePerSec = (m_drainRatePerSec * 0.8) + (instantRate * 0.2);
+	}
+};
@@ -13,10 +13,11 @@ class IA_Game
     static ref RandomGenerator rng = new RandomGenerator();
 
     private bool m_periodicTaskActive = false;
+    private ref IA_TaskScheduler m_scheduler = new IA_TaskScheduler();
     private ref array<IA_AreaInstance> m_areas = {};
 	private ref array<IA_AreaInstance> m_transientAreaInstances = {};
 	static private bool beenInstantiated = false;
-    static private ref array<IEntity> m_entityGc = {};
+    static private ref IA_EntityGc s_entityGc = new IA_EntityGc();
 
     // Static reference to the currently active area instance
     static IA_AreaInstance CurrentAreaInstance = null;
@@ -109,20 +110,17 @@ class IA_Game
     void ~IA_Game()
     {
         m_areas.Clear();
-        m_entityGc.Clear();
+        s_entityGc.Clear();
     }
 
     static void AddEntityToGc(IEntity e)
     {
-        m_entityGc.Insert(e);
+        s_entityGc.Add(e);
     }
 
-    private static void EntityGcTask()
+    static IA_EntityGc GetEntityGc()
     {
-        if (m_entityGc.IsEmpty())
-            return;
-        delete m_entityGc[0];
-        m_entityGc.Remove(0);
+        return s_entityGc;
     }
 	
 	private void ActivatePeriodicTask()
@@ -130,20 +128,15 @@ class IA_Game
 	    if (m_periodicTaskActive)
 	        return;
 	    m_periodicTaskActive = true;
-	    // Use a static wrapper so the instance's PeriodicalGameTask is called correctly.
-	    // Increase interval from 200ms to 1000ms (1 second) to reduce processing frequency
-	    GetGame().GetCallqueue().CallLater(PeriodicalGameTaskWrapper, 2000, true);
-	    GetGame().GetCallqueue().CallLater(EntityGcTask, 500, true);
+	    // Game-wide work and every area's tasks run through the frame-budgeted scheduler.
+	    m_scheduler.RegisterGameTask(IA_ScheduledTask.GameUpdate, IA_TaskScheduler.GAME_UPDATE_PERIOD_MS);
+	    m_scheduler.Start();
+	    s_entityGc.Start();
 	}
 
-	// Static wrapper that retrieves the singleton instance and calls its PeriodicalGameTask.
-	static void PeriodicalGameTaskWrapper()
+	IA_TaskScheduler GetScheduler()
 	{
-	    IA_Game gameInstance = IA_Game.Instantiate();
-	    if (gameInstance)
-	    {
-	        gameInstance.PeriodicalGameTask();
-	    }
+	    return m_scheduler;
 	}
 
     // Get current US player count in the game
@@ -157,31 +150,7 @@ class IA_Game
         }
         // --- END MODIFIED ---
 
-        int playerCount = 0;
-        PlayerManager playerManager = GetGame().GetPlayerManager();
-        
-        if (!playerManager)
-            return 0;
-            
-        array<int> playerIds = {};
-        playerManager.GetAllPlayers(playerIds);
-        
-        foreach (int playerId : playerIds)
-        {
-            IEntity playerEntity = playerManager.GetPlayerControlledEntity(playerId);
-            if (!playerEntity)
-                continue;
-			playerCount++;
-			
-            /*    
-            Faction faction = character.GetFaction();
-            if (faction && faction.GetFactionKey() == "US")
-            {
-                playerCount++;
-            }*/
-        }
-        
-        return playerCount;
+        return IA_PlayerSnapshot.Get().GetLiveCount();
     }
     
     // Calculate scale factor for AI spawning based on player count
@@ -191,7 +160,8 @@ class IA_Game
         IA_Config config = IA_MissionInitializer.GetGlobalConfig();
         if (config && config.m_fStaticAIScaleOverride > 0)
         {
-            Print(string.Format("[PLAYER_SCALING] Using static AI scale override from config: %1", config.m_fStaticAIScaleOverride), LogLevel.DEBUG);
+            if (IA_Log.Allow(IA_LogCategory.Scaling, "Scaling.Static", 60000, LogLevel.DEBUG))
+                IA_Log.Write(IA_LogCategory.Scaling, string.Format("Using static AI scale override from config: %1", config.m_fStaticAIScaleOverride), LogLevel.DEBUG);
             return config.m_fStaticAIScaleOverride;
         }
 
@@ -236,7 +206,8 @@ class IA_Game
         if (config && config.m_fAIScaleMultiplier != 1.0)
         {
             float finalScaleFactor = dynamicScaleFactor * config.m_fAIScaleMultiplier;
-            Print(string.Format("[PLAYER_SCALING] Dynamic scale %1 multiplied by config multiplier %2 = %3", dynamicScaleFactor, config.m_fAIScaleMultiplier, finalScaleFactor), LogLevel.DEBUG);
+            if (IA_Log.Allow(IA_LogCategory.Scaling, "Scaling.Multiplier", 60000, LogLevel.DEBUG))
+                IA_Log.Write(IA_LogCategory.Scaling, string.Format("Dynamic scale %1 multiplied by config multiplier %2 = %3", dynamicScaleFactor, config.m_fAIScaleMultiplier, finalScaleFactor), LogLevel.DEBUG);
             return finalScaleFactor;
         }
 
@@ -323,44 +294,17 @@ class IA_Game
 	    
 	    // Check player count for scaling
 	    CheckPlayerCount();
-	    
-	    foreach (IA_AreaInstance areaInst : m_areas)
-	    {
-				// --- BEGIN ADDED: Filter by Active Group ID ---
-				if (areaInst && areaInst.GetAreaGroup() != s_activeGroupID)
-				{
-					// Print(string.Format("[IA_Game.PeriodicalTask] Skipping Area '%1' (Group %2) - Active Group is %3", 
-					// 	areaInst.m_area.GetName(), areaInst.GetAreaGroup(), s_activeGroupID), LogLevel.DEBUG);
-					continue;
-				}
-				// --- END ADDED ---
-				
-				if(!areaInst || !areaInst.m_area){
-					//Print("areaInst.m_area is Null!!!",LogLevel.WARNING);
-					continue; // Use continue instead of return to process other areas
-				}else{
-					//Print("areaInst.m_area "+ areaInst.m_area.GetName() +"is NOT Null",LogLevel.NORMAL);
-					areaInst.RunNextTask();
-				}
-	        
-	    }
 		
-		// --- BEGIN ADDED: Process Transient Areas ---
-		// Process transient areas separately, iterating backwards for safe removal
+		// Area tasks themselves are dispatched by m_scheduler; only prune dead transient areas here.
 		for (int i = m_transientAreaInstances.Count() - 1; i >= 0; i--)
 	    {
 	        IA_AreaInstance transientAreaInst = m_transientAreaInstances[i];
-	        if (transientAreaInst && transientAreaInst.m_area)
-	        {
-	            transientAreaInst.RunNextTask();
-	        }
-	        else
+	        if (!transientAreaInst || !transientAreaInst.m_area)
 	        {
 	            // Clean up invalid transient areas that might have been nulled out elsewhere
 	            m_transientAreaInstances.Remove(i);
 	        }
 	    }
-		// --- END ADDED ---
 	}
 	
 
@@ -375,6 +319,7 @@ class IA_Game
 
         Print(string.Format("[IA_Game.AddArea] Adding Area '%1' (Group %2) to m_areas.", area.GetName(), groupID), LogLevel.WARNING);
         m_areas.Insert(inst);
+        m_scheduler.RegisterArea(inst);
         Print(string.Format("[IA_Game.AddArea] m_areas.Count() = %1 after adding %2", m_areas.Count(), area.GetName()), LogLevel.WARNING);
 
         IA_ReplicationWorkaround rep = IA_ReplicationWorkaround.Instance();
@@ -422,6 +367,7 @@ class IA_Game
                 }
             }
             m_areas.Clear();
+            m_scheduler.UnregisterGroupAreas();
         }
         else
         {
@@ -491,12 +437,19 @@ class IA_Game
         if (!game)
             return null;
 
-        foreach (IA_AreaInstance areaInst : game.GetAreaInstances())
+        // Markers from IA_AreaMarkerIndex share names with their area instances.
+        array<IA_AreaMarker> cell = IA_AreaMarkerIndex.GetCellMarkers(pos);
+        if (!cell)
+            return null;
+
+        foreach (IA_AreaMarker marker : cell)
         {
-            if (areaInst && areaInst.GetArea() && areaInst.GetArea().IsPositionInside(pos))
-            {
+            if (!marker || !marker.IsPositionInside(pos))
+                continue;
+
+            IA_AreaInstance areaInst = game.GetAreaInstance(marker.GetAreaName());
+            if (areaInst)
                 return areaInst;
-            }
         }
         return null;
     }
@@ -514,22 +467,9 @@ class IA_Game
     // --- END ADDED ---
 
     // --- BEGIN ADDED: Global Notification Helper ---
-    static void S_TriggerGlobalNotification(string messageType, string message)
+    static void S_TriggerGlobalNotification(IA_NotificationType type, string message)
     {
-        array<int> playerIDs = {};
-        GetGame().GetPlayerManager().GetAllPlayers(playerIDs);
-        foreach (int playerID : playerIDs)
-        {
-            PlayerController pc = GetGame().GetPlayerManager().GetPlayerController(playerID);
-            if(pc)
-            {
-                SCR_ChimeraCharacter character = SCR_ChimeraCharacter.Cast(pc.GetControlledEntity());
-                if(character)
-                {
-                    character.SetUIOne(messageType, message, playerID);
-                }
-            }
-        }
+        IA_NotificationReplicatorComponent.NotifyAll(type, message);
     }
     // --- END ADDED ---
 
@@ -540,6 +480,7 @@ class IA_Game
         {
             Print(string.Format("[IA_Game.AddTransientArea] Adding Transient Area '%1' to m_transientAreaInstances.", inst.GetArea().GetName()), LogLevel.DEBUG);
             m_transientAreaInstances.Insert(inst);
+            m_scheduler.RegisterArea(inst, true);
         }
     }
     
@@ -552,6 +493,7 @@ class IA_Game
             {
                 Print(string.Format("[IA_Game.RemoveTransientArea] Removing Transient Area '%1' from m_transientAreaInstances.", inst.GetArea().GetName()), LogLevel.DEBUG);
                 m_transientAreaInstances.Remove(index);
+                m_scheduler.UnregisterArea(inst);
             }
         }
     }
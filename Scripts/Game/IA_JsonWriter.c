@@ -0,0 +1,192 @@
+///////////////////////////////////////////////////////////////////////
+// IA_JsonWriter - chunked JSON builder
+///////////////////////////////////////////////////////////////////////
+
+//! Builds JSON without `json = json + ...` over the whole document. Small
+//! appends collect in a short pending buffer; full buffers become chunks that
+//! are joined pairwise once in ToString(), so cost grows with the output size
+//! instead of its square.
+//! Every Write*/Begin* call takes a key; pass "" for array elements.
+//! Output is compact (`"key":value`) so the key-search parsers in
+//! IA_AdminOverrides and IA_LocalOptions keep working.
+class IA_JsonWriter
+{
+	protected static const int CHUNK_CHARS = 512;
+
+	protected ref array<string> m_aChunks = {};
+	protected string m_sPending;
+	// One flag per open object/array: true until its first member is written.
+	protected ref array<bool> m_aFirst = {};
+
+	//------------------------------------------------------------------------------------------------
+	void BeginObject(string key = "")
+	{
+		Key(key);
+		Append("{");
+		m_aFirst.Insert(true);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void EndObject()
+	{
+		m_aFirst.Remove(m_aFirst.Count() - 1);
+		Append("}");
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void BeginArray(string key = "")
+	{
+		Key(key);
+		Append("[");
+		m_aFirst.Insert(true);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void EndArray()
+	{
+		m_aFirst.Remove(m_aFirst.Count() - 1);
+		Append("]");
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! String value, escaped the same way as IA_JsonEscape.
+	void WriteString(string key, string value)
+	{
+		Key(key);
+		Append("\"");
+		AppendEscaped(value);
+		Append("\"");
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void WriteInt(string key, int value)
+	{
+		Key(key);
+		Append(value.ToString());
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void WriteFloat(string key, float value)
+	{
+		Key(key);
+		Append(value.ToString());
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Booleans are written as 0/1, which is what the repo's readers expect.
+	void WriteBool(string key, bool value)
+	{
+		Key(key);
+		if (value)
+			Append("1");
+		else
+			Append("0");
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Already-serialized JSON (nested payloads, cached rows). Not escaped.
+	void WriteRaw(string key, string json)
+	{
+		Key(key);
+		Append(json);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void Reset()
+	{
+		m_aChunks.Clear();
+		m_aFirst.Clear();
+		m_sPending = "";
+	}
+
+	//------------------------------------------------------------------------------------------------
+	string ToString()
+	{
+		array<string> parts = {};
+		parts.Copy(m_aChunks);
+		if (!m_sPending.IsEmpty())
+			parts.Insert(m_sPending);
+
+		if (parts.IsEmpty())
+			return "";
+
+		// Pairwise rounds: each character is copied once per round, log2(chunks) rounds.
+		while (parts.Count() > 1)
+		{
+			array<string> merged = {};
+			int count = parts.Count();
+			for (int i = 0; i < count; i += 2)
+			{
+				if (i + 1 < count)
+					merged.Insert(parts[i] + parts[i + 1]);
+				else
+					merged.Insert(parts[i]);
+			}
+			parts = merged;
+		}
+		return parts[0];
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void Key(string key)
+	{
+		int depth = m_aFirst.Count();
+		if (depth > 0)
+		{
+			if (m_aFirst[depth - 1])
+				m_aFirst[depth - 1] = false;
+			else
+				Append(",");
+		}
+
+		if (key.IsEmpty())
+			return;
+
+		Append("\"");
+		AppendEscaped(key);
+		Append("\":");
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void Append(string text)
+	{
+		m_sPending += text;
+		if (m_sPending.Length() < CHUNK_CHARS)
+			return;
+
+		m_aChunks.Insert(m_sPending);
+		m_sPending = "";
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Copies clean runs as substrings; drops control chars, escapes quotes and backslashes.
+	protected void AppendEscaped(string value)
+	{
+		int len = value.Length();
+		int runStart = 0;
+		for (int i = 0; i < len; i++)
+		{
+			string ch = value.Get(i);
+			string replacement;
+			if (ch == "\"")
+				replacement = "\\\"";
+			else if (ch == "\\")
+				replacement = "\\\\";
+			else if (ch.ToAscii() < 32)
+				replacement = "";
+			else
+				continue;
+
+			if (i > runStart)
+				Append(value.Substring(runStart, i - runStart));
+			if (!replacement.IsEmpty())
+				Append(replacement);
+			runStart = i + 1;
+		}
+
+		if (runStart == 0)
+			Append(value);
+		else if (runStart < len)
+			Append(value.Substring(runStart, len - runStart));
+	}
+};
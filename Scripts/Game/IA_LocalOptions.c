@@ -120,15 +120,12 @@ class IA_LocalOptions
 	//------------------------------------------------------------------------------------------------
 	protected string ToJson()
 	{
-		int hideHud = 0;
-		if (m_bHideRankHud)
-			hideHud = 1;
-
-		int hidePromo = 0;
-		if (m_bHidePromotionNotifications)
-			hidePromo = 1;
-
-		return "{\"hideRankHud\":" + hideHud.ToString() + ",\"hidePromotionNotifications\":" + hidePromo.ToString() + "}";
+		IA_JsonWriter writer = new IA_JsonWriter();
+		writer.BeginObject();
+		writer.WriteBool("hideRankHud", m_bHideRankHud);
+		writer.WriteBool("hidePromotionNotifications", m_bHidePromotionNotifications);
+		writer.EndObject();
+		return writer.ToString();
 	}
 
 	//------------------------------------------------------------------------------------------------
@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////
+// IA_Log - category-filtered, rate-limited logging
+///////////////////////////////////////////////////////////////////////
+
+//! Log categories. Bit flags; IA_Config.m_eLogCategories holds the enabled set.
+enum IA_LogCategory
+{
+	General		= 1,
+	Area		= 2,
+	Military	= 4,
+	Civilian	= 8,
+	QRF			= 16,
+	Artillery	= 32,
+	Scaling		= 64,
+	Capture		= 128,
+	Vehicles	= 256
+};
+
+//! Replacement for eager Print(string.Format(...)) on hot paths. Guard the call so the
+//! message is only built when it will be written:
+//!     if (IA_Log.IsOn(IA_LogCategory.QRF))
+//!         IA_Log.Write(IA_LogCategory.QRF, string.Format("...", a, b));
+//! Allow() adds a per-site minimum interval; a site that was throttled reports how many
+//! messages it dropped on its next write. Warnings and errors always pass the category mask.
+//! Everything written also goes into a ring buffer that Dump() prints and saves on demand.
+class IA_Log
+{
+	static const int RING_SIZE = 512;
+	static const string DUMP_DIR = "$profile:MikesInvadeAndAnnex";
+	static const string DUMP_PATH = "$profile:MikesInvadeAndAnnex/log_dump.txt";
+
+	protected static int s_iMask = IA_LogCategory.General | IA_LogCategory.Area | IA_LogCategory.Capture;
+	protected static bool s_bConsole = true;
+
+	// Per-site throttle: last write (tick ms) and messages dropped since.
+	protected static ref map<string, int> s_mSiteLastMs = new map<string, int>();
+	protected static ref map<string, int> s_mSiteDropped = new map<string, int>();
+	// Dropped count picked up by the Write() that follows a passing Allow().
+	protected static int s_iPendingDropped;
+
+	protected static ref array<string> s_aRing = {};
+	protected static int s_iRingNext;
+
+	//------------------------------------------------------------------------------------------------
+	//! Reads the category mask and console switch from the mission config.
+	static void ApplyConfig(IA_Config config)
+	{
+		if (!config)
+			return;
+
+		s_iMask = config.m_eLogCategories;
+		s_bConsole = config.m_bLogToConsole;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static void SetMask(int mask)
+	{
+		s_iMask = mask;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static int GetMask()
+	{
+		return s_iMask;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static bool IsOn(IA_LogCategory category, LogLevel level = LogLevel.NORMAL)
+	{
+		if (level >= LogLevel.WARNING)
+			return true;
+		return (s_iMask & category) != 0;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! IsOn plus a minimum interval per call site. `site` is a short literal naming the message.
+	static bool Allow(IA_LogCategory category, string site, int minIntervalMs, LogLevel level = LogLevel.NORMAL)
+	{
+		if (!IsOn(category, level))
+			return false;
+
+		int now = System.GetTickCount();
+		int last;
+		if (s_mSiteLastMs.Find(site, last) && now - last < minIntervalMs)
+		{
+			s_mSiteDropped.Set(site, s_mSiteDropped.Get(site) + 1);
+			return false;
+		}
+
+		s_mSiteLastMs.Set(site, now);
+		s_iPendingDropped = s_mSiteDropped.Get(site);
+		s_mSiteDropped.Set(site, 0);
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Writes an already-built message. Call only after IsOn/Allow returned true.
+	static void Write(IA_LogCategory category, string message, LogLevel level = LogLevel.NORMAL)
+	{
+		string line = "[IA][" + typename.EnumToString(IA_LogCategory, category) + "] " + message;
+		if (s_iPendingDropped > 0)
+		{
+			line += " (+" + s_iPendingDropped.ToString() + " suppressed)";
+			s_iPendingDropped = 0;
+		}
+
+		PushRing(System.GetTickCount().ToString() + " " + line);
+
+		if (s_bConsole || level >= LogLevel.WARNING)
+			Print(line, level);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static void PushRing(string line)
+	{
+		if (s_aRing.Count() < RING_SIZE)
+		{
+			s_aRing.Insert(line);
+			return;
+		}
+		s_aRing[s_iRingNext] = line;
+		s_iRingNext = (s_iRingNext + 1) % RING_SIZE;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Ring contents, oldest first.
+	static void GetRecent(notnull array<string> outLines)
+	{
+		outLines.Clear();
+		int count = s_aRing.Count();
+		int start = 0;
+		if (count == RING_SIZE)
+			start = s_iRingNext;
+
+		for (int i = 0; i < count; i++)
+		{
+			outLines.Insert(s_aRing[(start + i) % count]);
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Prints the ring to the console and writes it to DUMP_PATH. Returns lines dumped.
+	static int Dump()
+	{
+		array<string> lines = {};
+		GetRecent(lines);
+
+		Print("[IA][Log] ---- ring dump: " + lines.Count().ToString() + " lines ----", LogLevel.NORMAL);
+		foreach (string line : lines)
+		{
+			Print(line, LogLevel.NORMAL);
+		}
+
+		FileIO.MakeDirectory(DUMP_DIR);
+		FileHandle file = FileIO.OpenFile(DUMP_PATH, FileMode.WRITE);
+		if (!file)
+		{
+			Print("[IA][Log] Failed to open " + DUMP_PATH, LogLevel.ERROR);
+			return lines.Count();
+		}
+
+		foreach (string fileLine : lines)
+		{
+			file.WriteLine(fileLine);
+		}
+		file.Close();
+		return lines.Count();
+	}
+}
@@ -32,6 +32,8 @@ class IA_MissionInitializer : GenericEntity
 	private bool m_civilianRevoltActive = false;
 	private bool m_runOnce = false;
 	private ref IA_AreaGroupManager m_currentAreaGroupManager;
+	// Picked when the next zone is scheduled so IA_PrefabCache can warm for it.
+	private Faction m_nextAreaFaction;
 	
 	// --- BEGIN ADDED: Artillery Cooldown ---
     static int s_artilleryDisabledUntil = 0;
@@ -221,6 +223,18 @@ class IA_MissionInitializer : GenericEntity
 		return actualFactions[Math.RandomInt(0, actualFactions.Count()-1)];
 	}
 	
+	//! Picks the next zone's enemy faction now and starts loading its prefabs
+	//! while the between-zone delay runs.
+	protected void PrepareNextZone()
+	{
+		if (!groupsArray || m_currentIndex < 0 || m_currentIndex >= groupsArray.Count())
+			return;
+
+		m_nextAreaFaction = GetRandomEnemyFaction();
+		if (m_nextAreaFaction)
+			IA_PrefabCache.Warm(m_nextAreaFaction);
+	}
+
 	void ProceedToNextZone()
 	{
 	    if (!groupsArray || groupsArray.IsEmpty())
@@ -262,7 +276,13 @@ class IA_MissionInitializer : GenericEntity
 		m_initialCiviliansCounted = false;
 		m_civilianRevoltActive = false;
 
-	    Faction nextAreaFaction = GetRandomEnemyFaction();
+	    Faction nextAreaFaction = m_nextAreaFaction;
+	    m_nextAreaFaction = null;
+	    if (!nextAreaFaction)
+	    {
+	        nextAreaFaction = GetRandomEnemyFaction();
+	        IA_PrefabCache.Warm(nextAreaFaction);
+	    }
 		Print("Next Faction is = " +nextAreaFaction.GetFactionName(), LogLevel.NORMAL);
 	    int currentGroup = groupsArray[m_currentIndex];
 	    ////Print("[DEBUG_ZONE_GROUP] Proceeding to zone group " + currentGroup + " (index " + m_currentIndex + " of " + groupsArray.Count() + ")", LogLevel.WARNING);
@@ -281,6 +301,8 @@ class IA_MissionInitializer : GenericEntity
 	    // Ensure every AO has a MortarPit site (map-authored marker wins over auto-place)
 	    IA_MortarPitPlacer.EnsureForGroup(currentGroup);
 	    IA_AreaMarker.EnsureRadioTowersForGroup(currentGroup);
+	    IA_RoadPointIndex.Build(currentGroup);
+	    IA_ThreatMap.Build(currentGroup);
 	    
 	    // m_currentAreaInstances.Clear(); // Clear for the new zone group - MOVED LATER
 	    // array<IA_AreaMarker> markersInGroup = {}; - MOVED LATER
@@ -451,6 +473,7 @@ class IA_MissionInitializer : GenericEntity
     }*/
 	Shuffle(groupsArray);
     m_currentIndex = 0;
+    PrepareNextZone();
     ProceedToNextZone();
 }
 
@@ -469,7 +492,7 @@ class IA_MissionInitializer : GenericEntity
 		}
 
 		// Notification for revolt start
-		GetGame().GetCallqueue().CallLater(TriggerGlobalNotification, notificationDelay, false, "CivilianRevoltStarted", "Civilian Revolt");
+		GetGame().GetCallqueue().CallLater(TriggerGlobalNotification, notificationDelay, false, IA_NotificationType.CivilianRevoltStarted, "Civilian Revolt");
 
 		if (!m_currentAreaInstances)
 			return;
@@ -527,7 +550,7 @@ class IA_MissionInitializer : GenericEntity
 		}
 
 		// Notification for reinforcements sighted
-		GetGame().GetCallqueue().CallLater(TriggerGlobalNotification, reinforcementDelay2 + notificationDelay2, false, "CivilianRevoltReinforcements", "Civilian Reinforcements");
+		GetGame().GetCallqueue().CallLater(TriggerGlobalNotification, reinforcementDelay2 + notificationDelay2, false, IA_NotificationType.CivilianRevoltReinforcements, "Civilian Reinforcements");
 	}
 
 
@@ -608,11 +631,13 @@ class IA_MissionInitializer : GenericEntity
 
         if (m_currentAreaGroupManager)
 		{
-			Print("[AreaGroupManager] Performing periodic check for area group " + groupsArray[m_currentIndex], LogLevel.NORMAL);
+			if (IA_Log.Allow(IA_LogCategory.Area, "Group.PeriodicCheck", 60000))
+				IA_Log.Write(IA_LogCategory.Area, "Performing periodic check for area group " + groupsArray[m_currentIndex]);
             int currentTime = System.GetUnixTime();
             if (s_artilleryDisabledUntil > 0 && currentTime < s_artilleryDisabledUntil)
             {
-                Print(string.Format("[IA_MissionInitializer] Skipping artillery check due to side objective cooldown. %1 seconds remaining.", s_artilleryDisabledUntil - currentTime), LogLevel.DEBUG);
+                if (IA_Log.Allow(IA_LogCategory.Artillery, "Arty.SideCooldown", 60000, LogLevel.DEBUG))
+                    IA_Log.Write(IA_LogCategory.Artillery, string.Format("Skipping artillery check due to side objective cooldown. %1 seconds remaining.", s_artilleryDisabledUntil - currentTime), LogLevel.DEBUG);
             }
             else 
             {
@@ -620,7 +645,10 @@ class IA_MissionInitializer : GenericEntity
             }
 
             // Always evaluate QRF independently of artillery state
+            int qrfStart = IA_Profiler.Begin();
             m_currentAreaGroupManager.QRFTask();
+            if (IA_Profiler.IsEnabled())
+                IA_Profiler.End("QRFTask", qrfStart, "Group " + groupsArray[m_currentIndex].ToString());
 		}
 		
 		////Print("Running CheckCurrentZoneComplete 1",LogLevel.NORMAL);
@@ -778,7 +806,7 @@ class IA_MissionInitializer : GenericEntity
 	{
 		// --- BEGIN ADDED: Trigger RTB notification only when actually proceeding to next zone ---
 		// Only send RTB notification if we're not starting a defend mission
-		TriggerGlobalNotification("AreaGroupCompleted", "Return to base and await further tasking.");
+		TriggerGlobalNotification(IA_NotificationType.AreaGroupCompleted, "Return to base and await further tasking.");
 		NotifyAoTopContributors();
 		// --- END ADDED ---
 		
@@ -797,6 +825,7 @@ class IA_MissionInitializer : GenericEntity
 		if (finalDelay < 0)
 		    finalDelay = Math.RandomInt(45,90)*1000;
 		    
+		PrepareNextZone();
 		GetGame().GetCallqueue().CallLater(ProceedToNextZone, finalDelay, false); // Start next group
 	
 	}
@@ -825,22 +854,12 @@ class IA_MissionInitializer : GenericEntity
 		if (message.IsEmpty())
 			return;
 
-		TriggerGlobalNotification("AoTopContributors", message);
+		TriggerGlobalNotification(IA_NotificationType.AoTopContributors, message);
 	}
 
-	void TriggerGlobalNotification(string messageType, string taskTitle)
+	void TriggerGlobalNotification(IA_NotificationType type, string taskTitle)
 	{
-		array<int> playerIDs = new array<int>();
-		GetGame().GetPlayerManager().GetAllPlayers(playerIDs);
-		foreach (int playerID : playerIDs){
-			PlayerController pc = GetGame().GetPlayerManager().GetPlayerController(playerID);
-			if(pc){
-			 	SCR_ChimeraCharacter character = SCR_ChimeraCharacter.Cast(pc.GetControlledEntity());
-				if(character){
-			 		character.SetUIOne(messageType, taskTitle, playerID);
-				}
-			}
-		}
+		IA_NotificationReplicatorComponent.NotifyAll(type, taskTitle);
 	}
 	// --- END ADDED ---
 
@@ -860,6 +879,7 @@ class IA_MissionInitializer : GenericEntity
 		// Load config file if specified
 		LoadConfig();
 		ApplyAdminOverrides();
+		IA_Log.ApplyConfig(m_config);
 
         // Set this instance as the reference for IA_AreaMarker
         IA_AreaMarker.SetMissionInitializer(this);
@@ -2001,7 +2021,7 @@ class IA_MissionInitializer : GenericEntity
 		Print("[IA_MissionInitializer] Defend mission completed, proceeding to next zone", LogLevel.NORMAL);
 		
 		// Trigger RTB notification just like normal area group completion
-		TriggerGlobalNotification("AreaGroupCompleted", "Return to base and await further tasking.");
+		TriggerGlobalNotification(IA_NotificationType.AreaGroupCompleted, "Return to base and await further tasking.");
 		NotifyAoTopContributors();
 		
 		// Clean up current area instances
@@ -2019,6 +2039,7 @@ class IA_MissionInitializer : GenericEntity
 		
 		// Remove the zone completion check and proceed to next zone
 		GetGame().GetCallqueue().Remove(CheckCurrentZoneComplete);
+		PrepareNextZone();
 		GetGame().GetCallqueue().CallLater(ProceedToNextZone, Math.RandomInt(45,90)*1000, false);
 	}
 	// --- END ADDED ---
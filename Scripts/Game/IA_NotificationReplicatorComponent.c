@@ -0,0 +1,258 @@
+//------------------------------------------------------------------------------------------------
+//! HUD notification kinds. Sent over the wire as an int; order is part of the protocol.
+//------------------------------------------------------------------------------------------------
+enum IA_NotificationType
+{
+	TaskCreated,
+	TaskCompleted,
+	AreaGroupCompleted,
+	AoTopContributors,
+	SideTaskCreated,
+	SideTaskCompleted,
+	HVTEscaping,
+	HVTEscaped,
+	HVTPreparingEscape,
+	RadioTowerDefenseStarted,
+	DefendMissionStarted,
+	CivilianRevoltStarted,
+	CivilianRevoltReinforcements,
+	CaptureStarted,
+	CapturePaused,
+	Capture50Percent,
+	GeneratorDestroyed,
+	ReinforcementsCalled
+};
+
+//------------------------------------------------------------------------------------------------
+//! One place that sends HUD notifications. A global notification is one broadcast RPC. Fixed
+//! titles travel as their index in s_aStaticTitles, which both sides compile in; per-event text
+//! (area names, QRF lines, contributor lists) is sent inline and never stored. Player and area
+//! notifications go only to the recipients, through their player controller.
+//------------------------------------------------------------------------------------------------
+[ComponentEditorProps(category: "Invade & Annex/Components", description: "Replicates HUD notifications to clients.")]
+class IA_NotificationReplicatorComponentClass : SCR_BaseGameModeComponentClass
+{
+}
+
+class IA_NotificationReplicatorComponent : SCR_BaseGameModeComponent
+{
+	// Fixed notification titles. Sent over the wire by index: append only.
+	protected static ref array<string> s_aStaticTitles = {
+		"Civilian Revolt",
+		"Civilian Reinforcements",
+		"Return to base and await further tasking.",
+		"Side Objective Completed. The HVT has been eliminated. Enemy artillery and QRF is unavailable for 20 minutes.",
+		"Side Objective: Generator Destroyed! Enemy reinforcements disabled!",
+		"Side Objective: HVT has reached the extraction point! Eliminate them immediately!",
+		"Side Objective: The HVT has Escaped! Mission Failed.",
+		"Side Objective: The HVT is preparing to make their escape!"
+	};
+
+	protected static ref map<string, int> s_mStaticTitleIds;
+	protected static IA_NotificationReplicatorComponent s_Instance;
+
+	//------------------------------------------------------------------------------------------------
+	static IA_NotificationReplicatorComponent GetInstance()
+	{
+		return s_Instance;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Server: show `title` to every player.
+	static void NotifyAll(IA_NotificationType type, string title)
+	{
+		if (!Replication.IsServer())
+			return;
+		if (!s_Instance)
+		{
+			Print("[IA][Notify] No IA_NotificationReplicatorComponent on the game mode.", LogLevel.ERROR);
+			return;
+		}
+		s_Instance.Broadcast(type, title);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Server: show `title` to one player only.
+	static void NotifyPlayer(int playerId, IA_NotificationType type, string title)
+	{
+		if (!Replication.IsServer())
+			return;
+
+		SCR_PlayerController pc = SCR_PlayerController.Cast(GetGame().GetPlayerManager().GetPlayerController(playerId));
+		if (pc)
+			pc.IA_Notify(type, title);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Server: show `title` to players whose character is within `radius` of `center`.
+	static void NotifyArea(vector center, float radius, IA_NotificationType type, string title)
+	{
+		if (!Replication.IsServer())
+			return;
+
+		IA_PlayerSnapshot snapshot = IA_PlayerSnapshot.Get();
+		float radiusSq = radius * radius;
+		int count = snapshot.GetConnectedCount();
+		for (int i = 0; i < count; i++)
+		{
+			if (!snapshot.GetEntity(i))
+				continue;
+			if (vector.DistanceSqXZ(snapshot.GetPosition(i), center) > radiusSq)
+				continue;
+			NotifyPlayer(snapshot.GetPlayerId(i), type, title);
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override void OnPostInit(IEntity owner)
+	{
+		super.OnPostInit(owner);
+		SetEventMask(owner, EntityEvent.INIT);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override void EOnInit(IEntity owner)
+	{
+		super.EOnInit(owner);
+		if (s_Instance && s_Instance != this)
+		{
+			Print("[IA][Notify] Instance already exists.", LogLevel.WARNING);
+			return;
+		}
+
+		s_Instance = this;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override void OnDelete(IEntity owner)
+	{
+		if (s_Instance == this)
+			s_Instance = null;
+		super.OnDelete(owner);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void Broadcast(IA_NotificationType type, string title)
+	{
+		int titleId = FindStaticTitle(title);
+		if (titleId >= 0)
+			Rpc(RpcDo_Notify, type, titleId);
+		else
+			Rpc(RpcDo_NotifyText, type, title);
+
+		// Broadcast RPCs don't run on the sender; a listen host shows it here.
+		if (GetGame().GetPlayerController())
+			Display(type, title);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Index of `title` in s_aStaticTitles, or -1 for per-event text.
+	protected static int FindStaticTitle(string title)
+	{
+		if (!s_mStaticTitleIds)
+		{
+			s_mStaticTitleIds = new map<string, int>();
+			foreach (int i, string staticTitle : s_aStaticTitles)
+			{
+				s_mStaticTitleIds.Insert(staticTitle, i);
+			}
+		}
+
+		int titleId;
+		if (s_mStaticTitleIds.Find(title, titleId))
+			return titleId;
+		return -1;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[RplRpc(RplChannel.Reliable, RplRcver.Broadcast)]
+	protected void RpcDo_Notify(int type, int titleId)
+	{
+		if (!s_aStaticTitles.IsIndexValid(titleId))
+		{
+			Print("[IA][Notify] Unknown title id " + titleId.ToString(), LogLevel.WARNING);
+			return;
+		}
+		Display(type, s_aStaticTitles[titleId]);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[RplRpc(RplChannel.Reliable, RplRcver.Broadcast)]
+	protected void RpcDo_NotifyText(int type, string title)
+	{
+		Display(type, title);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Local HUD presentation for one notification.
+	static void Display(IA_NotificationType type, string title)
+	{
+		PlayerController pc = GetGame().GetPlayerController();
+		if (!pc)
+			return;
+
+		SCR_HUDManagerComponent displayManager = SCR_HUDManagerComponent.Cast(pc.FindComponent(SCR_HUDManagerComponent));
+		if (!displayManager)
+			return;
+
+		IA_NotificationDisplay notificationDisplay = IA_NotificationDisplay.Cast(displayManager.FindInfoDisplay(IA_NotificationDisplay));
+		if (!notificationDisplay)
+		{
+			Print("[IA][Notify] Could not find IA_NotificationDisplay for local player.", LogLevel.WARNING);
+			return;
+		}
+
+		ScriptCallQueue queue = GetGame().GetCallqueue();
+		switch (type)
+		{
+			case IA_NotificationType.TaskCreated:
+				queue.CallLater(notificationDisplay.DisplayTaskCreatedNotification, 100, false, title);
+				break;
+			case IA_NotificationType.TaskCompleted:
+				queue.CallLater(notificationDisplay.DisplayTaskCompletedNotification, 100, false, title);
+				break;
+			case IA_NotificationType.AreaGroupCompleted:
+				queue.CallLater(notificationDisplay.DisplayAreaCompletedNotification, 100, false, title);
+				break;
+			case IA_NotificationType.AoTopContributors:
+				queue.CallLater(notificationDisplay.DisplayAoTopContributorsNotification, 100, false, title);
+				break;
+			case IA_NotificationType.SideTaskCreated:
+				queue.CallLater(notificationDisplay.DisplaySideTaskCreatedNotification, 100, false, title);
+				break;
+			case IA_NotificationType.SideTaskCompleted:
+				notificationDisplay.QueueNotification(title, "green", 12000);
+				break;
+			case IA_NotificationType.DefendMissionStarted:
+				notificationDisplay.DisplayTaskCreatedNotification(title);
+				break;
+			case IA_NotificationType.RadioTowerDefenseStarted:
+				notificationDisplay.QueueNotification("Enemy reinforcements are responding! Destroy the " + title + " to prevent their continuous reinforcements.", "yellow", 10000);
+				break;
+			case IA_NotificationType.CivilianRevoltStarted:
+				notificationDisplay.QueueNotification("The civilian population is revolting! Be advised, they are now hostile.", "red", 10000);
+				break;
+			case IA_NotificationType.CivilianRevoltReinforcements:
+				notificationDisplay.QueueNotification("Civilian militias are reinforcing the objective areas!", "red", 10000);
+				break;
+			case IA_NotificationType.CaptureStarted:
+			case IA_NotificationType.Capture50Percent:
+				if (!notificationDisplay.IsCaptureHudActive())
+					notificationDisplay.QueueNotification(title, "green", 5000);
+				break;
+			case IA_NotificationType.CapturePaused:
+				if (!notificationDisplay.IsCaptureHudActive())
+					notificationDisplay.QueueNotification(title, "yellow", 5000);
+				break;
+			case IA_NotificationType.GeneratorDestroyed:
+				notificationDisplay.QueueNotification(title, "green", 10000);
+				break;
+			case IA_NotificationType.HVTEscaping:
+			case IA_NotificationType.HVTEscaped:
+			case IA_NotificationType.HVTPreparingEscape:
+			case IA_NotificationType.ReinforcementsCalled:
+				notificationDisplay.QueueNotification(title, "red", 10000);
+				break;
+		}
+	}
+}
@@ -65,6 +65,103 @@ modded class SCR_PlayerController
 		Rpc(RpcAsk_IA_PromoteSelf);
 	}
 
+	//------------------------------------------------------------------------------------------------
+	//! Admin performance page: ask for the current profiler readout.
+	void IA_AskPerfReport()
+	{
+		if (Replication.IsServer())
+		{
+			IA_SendPerfReportIfAdmin();
+			return;
+		}
+
+		Rpc(RpcAsk_IA_PerfReport);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Admin performance page: switch server-side sampling on or off.
+	void IA_AskSetProfiling(bool enabled)
+	{
+		if (Replication.IsServer())
+		{
+			IA_SetProfilingIfAdmin(enabled);
+			return;
+		}
+
+		Rpc(RpcAsk_IA_SetProfiling, enabled);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void IA_AskSetPerfCsv(bool enabled)
+	{
+		if (Replication.IsServer())
+		{
+			IA_SetPerfCsvIfAdmin(enabled);
+			return;
+		}
+
+		Rpc(RpcAsk_IA_SetPerfCsv, enabled);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Admin: write the server's IA_Log ring to its console and profile.
+	void IA_AskDumpLog()
+	{
+		if (Replication.IsServer())
+		{
+			IA_DumpLogIfAdmin();
+			return;
+		}
+
+		Rpc(RpcAsk_IA_DumpLog);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Session rank client missed a delta; ask the server for the full table.
+	void IA_AskSessionRankResync()
+	{
+		if (Replication.IsServer())
+			return;
+
+		Rpc(RpcAsk_IA_SessionRankResync);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Server: full session rank table for this controller's player only.
+	void IA_SendSessionRankSnapshot(int version, array<int> packed, array<string> strings)
+	{
+		Rpc(RpcDo_IA_SessionRankSnapshot, version, packed, strings);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[RplRpc(RplChannel.Reliable, RplRcver.Owner)]
+	protected void RpcDo_IA_SessionRankSnapshot(int version, array<int> packed, array<string> strings)
+	{
+		IA_SessionRankManagerComponent session = IA_SessionRankManagerComponent.GetInstance();
+		if (session)
+			session.ApplySnapshot(version, packed, strings);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Server: HUD notification for this controller's player only.
+	void IA_Notify(IA_NotificationType type, string title)
+	{
+		if (GetGame().GetPlayerController() == this)
+		{
+			IA_NotificationReplicatorComponent.Display(type, title);
+			return;
+		}
+
+		Rpc(RpcDo_IA_Notify, type, title);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[RplRpc(RplChannel.Reliable, RplRcver.Owner)]
+	protected void RpcDo_IA_Notify(int type, string title)
+	{
+		IA_NotificationReplicatorComponent.Display(type, title);
+	}
+
 	//------------------------------------------------------------------------------------------------
 	[RplRpc(RplChannel.Reliable, RplRcver.Server)]
 	protected void RpcAsk_IA_UpdateAdminConfig(string packed)
@@ -93,6 +190,50 @@ modded class SCR_PlayerController
 		IA_ForceCompleteZoneIfAdmin();
 	}
 
+	//------------------------------------------------------------------------------------------------
+	[RplRpc(RplChannel.Reliable, RplRcver.Server)]
+	protected void RpcAsk_IA_SessionRankResync()
+	{
+		IA_SessionRankManagerComponent session = IA_SessionRankManagerComponent.GetInstance();
+		if (session)
+			session.RequestFullResync(GetPlayerId());
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[RplRpc(RplChannel.Reliable, RplRcver.Server)]
+	protected void RpcAsk_IA_PerfReport()
+	{
+		IA_SendPerfReportIfAdmin();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[RplRpc(RplChannel.Reliable, RplRcver.Server)]
+	protected void RpcAsk_IA_SetProfiling(bool enabled)
+	{
+		IA_SetProfilingIfAdmin(enabled);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[RplRpc(RplChannel.Reliable, RplRcver.Server)]
+	protected void RpcAsk_IA_SetPerfCsv(bool enabled)
+	{
+		IA_SetPerfCsvIfAdmin(enabled);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[RplRpc(RplChannel.Reliable, RplRcver.Server)]
+	protected void RpcAsk_IA_DumpLog()
+	{
+		IA_DumpLogIfAdmin();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[RplRpc(RplChannel.Reliable, RplRcver.Owner)]
+	protected void RpcDo_IA_PerfReport(string report, bool enabled, bool csvEnabled)
+	{
+		IA_Profiler.ReceiveReport(report, enabled, csvEnabled);
+	}
+
 	//------------------------------------------------------------------------------------------------
 	[RplRpc(RplChannel.Reliable, RplRcver.Server)]
 	protected void RpcAsk_IA_PromoteSelf()
@@ -189,6 +330,78 @@ modded class SCR_PlayerController
 		session.PromotePlayer(GetPlayerId());
 	}
 
+	//------------------------------------------------------------------------------------------------
+	protected void IA_SendPerfReportIfAdmin()
+	{
+		if (!IA_IsAdminCaller())
+		{
+			Print("[IA] Perf report rejected: caller is not admin (player " + GetPlayerId().ToString() + ")", LogLevel.WARNING);
+			return;
+		}
+
+		array<string> lines = {};
+		IA_Profiler.BuildReport(lines, IA_Profiler.REPORT_ROWS - 4);
+		lines.InsertAt(IA_AiGroup.GetOrderReportLine(), 0);
+		lines.InsertAt(IA_WaypointPool.GetReportLine(), 0);
+		lines.InsertAt(IA_SpawnPointPool.Get().GetReportLine(), 0);
+		lines.InsertAt(IA_PrefabCache.GetReportLine(), 0);
+
+		string report;
+		foreach (int i, string line : lines)
+		{
+			if (i > 0)
+				report += "\n";
+			report += line;
+		}
+
+		if (GetGame().GetPlayerController() == this)
+		{
+			IA_Profiler.ReceiveReport(report, IA_Profiler.IsEnabled(), IA_Profiler.IsCsvEnabled());
+			return;
+		}
+
+		Rpc(RpcDo_IA_PerfReport, report, IA_Profiler.IsEnabled(), IA_Profiler.IsCsvEnabled());
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void IA_SetProfilingIfAdmin(bool enabled)
+	{
+		if (!IA_IsAdminCaller())
+		{
+			Print("[IA] Profiling toggle rejected: caller is not admin (player " + GetPlayerId().ToString() + ")", LogLevel.WARNING);
+			return;
+		}
+
+		IA_Profiler.SetEnabled(enabled);
+		IA_SendPerfReportIfAdmin();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void IA_SetPerfCsvIfAdmin(bool enabled)
+	{
+		if (!IA_IsAdminCaller())
+		{
+			Print("[IA] Perf CSV toggle rejected: caller is not admin (player " + GetPlayerId().ToString() + ")", LogLevel.WARNING);
+			return;
+		}
+
+		IA_Profiler.SetCsvEnabled(enabled);
+		IA_SendPerfReportIfAdmin();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void IA_DumpLogIfAdmin()
+	{
+		if (!IA_IsAdminCaller())
+		{
+			Print("[IA] Log dump rejected: caller is not admin (player " + GetPlayerId().ToString() + ")", LogLevel.WARNING);
+			return;
+		}
+
+		int lines = IA_Log.Dump();
+		Print("[IA] Log ring dumped by player " + GetPlayerId().ToString() + ": " + lines.ToString() + " lines to " + IA_Log.DUMP_PATH, LogLevel.NORMAL);
+	}
+
 	//------------------------------------------------------------------------------------------------
 	protected bool IA_IsAdminCaller()
 	{
@@ -43,20 +43,16 @@ class IA_PlayerRoleHandler
         if (!Replication.IsServer())
             return;
             
-        // Get the player manager
-        PlayerManager playerManager = GetGame().GetPlayerManager();
-        if (!playerManager)
-            return;
-            
-        // Get all current players
-        array<int> currentPlayers = {};
-        playerManager.GetPlayers(currentPlayers);
+        // Shared per-frame player snapshot (ids + controlled entities)
+        IA_PlayerSnapshot snapshot = IA_PlayerSnapshot.Get();
+        int playerCount = snapshot.GetConnectedCount();
         
         map<string, bool> currentPlayerGuids = new map<string, bool>();
         
         // Check for new players that we haven't processed yet, and reapply roles for existing players
-        foreach (int playerId : currentPlayers)
+        for (int i = 0; i < playerCount; i++)
         {
+            int playerId = snapshot.GetPlayerId(i);
             string playerGuid = SCR_PlayerIdentityUtils.GetPlayerIdentityId(playerId);
             if (playerGuid.IsEmpty())
                 continue;
@@ -87,7 +83,7 @@ class IA_PlayerRoleHandler
             }
             
             // --- Attach death listener if player has a new character ---
-            IEntity playerEntity = playerManager.GetPlayerControlledEntity(playerId);
+            IEntity playerEntity = snapshot.GetEntity(i);
             if (playerEntity)
             {
 				EntityID currentCharacterId = playerEntity.GetID();
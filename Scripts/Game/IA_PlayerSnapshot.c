@@ -0,0 +1,171 @@
+///////////////////////////////////////////////////////////////////////
+// IA_PlayerSnapshot - per-frame cache of connected players
+///////////////////////////////////////////////////////////////////////
+
+//! One shared read of PlayerManager per frame. The first caller in a frame
+//! refreshes it; everyone after that reads the cached arrays.
+//! Arrays returned by the getters are owned by the snapshot - do not modify them.
+class IA_PlayerSnapshot
+{
+	private static ref IA_PlayerSnapshot s_instance;
+
+	private float m_lastWorldTime = -1;
+
+	// Parallel arrays over every connected player. Entity may be null (dead / spawning).
+	private ref array<int> m_playerIds = {};
+	private ref array<IEntity> m_entities = {};
+	private ref array<vector> m_positions = {};
+	private ref array<Faction> m_factions = {};
+
+	// Compact list of positions for players that currently control an entity.
+	private ref array<vector> m_livePositions = {};
+
+	static IA_PlayerSnapshot Get()
+	{
+		if (!s_instance)
+			s_instance = new IA_PlayerSnapshot();
+		s_instance.RefreshIfStale();
+		return s_instance;
+	}
+
+	//! Drops the cached frame so the next Get() re-reads PlayerManager.
+	static void Invalidate()
+	{
+		if (s_instance)
+			s_instance.m_lastWorldTime = -1;
+	}
+
+	private void RefreshIfStale()
+	{
+		BaseWorld world = GetGame().GetWorld();
+		if (world)
+		{
+			float now = world.GetWorldTime();
+			if (now == m_lastWorldTime)
+				return;
+			m_lastWorldTime = now;
+		}
+		Refresh();
+	}
+
+	private void Refresh()
+	{
+		m_playerIds.Clear();
+		m_entities.Clear();
+		m_positions.Clear();
+		m_factions.Clear();
+		m_livePositions.Clear();
+
+		PlayerManager playerManager = GetGame().GetPlayerManager();
+		if (!playerManager)
+			return;
+
+		playerManager.GetPlayers(m_playerIds);
+
+		int count = m_playerIds.Count();
+		for (int i = 0; i < count; i++)
+		{
+			IEntity playerEntity = playerManager.GetPlayerControlledEntity(m_playerIds[i]);
+			m_entities.Insert(playerEntity);
+
+			if (!playerEntity)
+			{
+				m_positions.Insert(vector.Zero);
+				m_factions.Insert(null);
+				continue;
+			}
+
+			vector pos = playerEntity.GetOrigin();
+			m_positions.Insert(pos);
+			m_livePositions.Insert(pos);
+
+			Faction faction = null;
+			SCR_ChimeraCharacter character = SCR_ChimeraCharacter.Cast(playerEntity);
+			if (character)
+				faction = character.GetFaction();
+			m_factions.Insert(faction);
+		}
+	}
+
+	//! Number of connected players, with or without a controlled entity.
+	int GetConnectedCount()
+	{
+		return m_playerIds.Count();
+	}
+
+	//! Number of players currently controlling an entity.
+	int GetLiveCount()
+	{
+		return m_livePositions.Count();
+	}
+
+	int GetPlayerId(int index)
+	{
+		return m_playerIds[index];
+	}
+
+	IEntity GetEntity(int index)
+	{
+		return m_entities[index];
+	}
+
+	vector GetPosition(int index)
+	{
+		return m_positions[index];
+	}
+
+	Faction GetFaction(int index)
+	{
+		return m_factions[index];
+	}
+
+	array<int> GetPlayerIds()
+	{
+		return m_playerIds;
+	}
+
+	array<vector> GetLivePositions()
+	{
+		return m_livePositions;
+	}
+
+	int FindIndex(int playerId)
+	{
+		return m_playerIds.Find(playerId);
+	}
+
+	IEntity GetControlledEntity(int playerId)
+	{
+		int index = m_playerIds.Find(playerId);
+		if (index == -1)
+			return null;
+		return m_entities[index];
+	}
+
+	//! Squared XZ distance from `pos` to the closest player with an entity; -1 if there is none.
+	float NearestLiveDistanceSqXZ(vector pos)
+	{
+		float best = -1;
+		int count = m_livePositions.Count();
+		for (int i = 0; i < count; i++)
+		{
+			float distSq = vector.DistanceSqXZ(m_livePositions[i], pos);
+			if (best < 0 || distSq < best)
+				best = distSq;
+		}
+		return best;
+	}
+
+	int CountInRadius(vector center, float radius)
+	{
+		float radiusSq = radius * radius;
+		int inside = 0;
+		int count = m_livePositions.Count();
+		for (int i = 0; i < count; i++)
+		{
+			if (vector.DistanceSq(m_livePositions[i], center) <= radiusSq)
+				inside++;
+		}
+		return inside;
+	}
+};
@@ -0,0 +1,195 @@
+///////////////////////////////////////////////////////////////////////
+// IA_PrefabCache - preloaded spawn prefabs
+///////////////////////////////////////////////////////////////////////
+
+//! Keeps strong Resource references for what an AO spawns, so the first squad,
+//! civilian or vehicle of a type doesn't pay Resource.Load mid-fight.
+//! Spawn code calls Load() instead of Resource.Load(); Warm() queues everything
+//! the next AO can spawn and loads it a few prefabs per frame. A miss is a Load()
+//! that had to go to disk: after warming, misses should stay at zero.
+class IA_PrefabCache
+{
+	static const int WARM_PER_FRAME = 8;
+
+	static const string GROUP_CIV = "{71783D1DEDC4E150}Prefabs/Groups/Group_CIV.et";
+	static const string GROUP_USSR_BASE = "{8DE0C0830FE0C33D}Prefabs/Groups/OPFOR/Group_USSR_Base.et";
+	static const string GROUP_US_BASE = "{EACD97CF4A702FAE}Prefabs/Groups/BLUFOR/Group_US_Base.et";
+	static const string GROUP_FIA_BASE = "{242BC3C6BCE96EA5}Prefabs/Groups/INDFOR/Group_FIA_Base.et";
+	static const string HVT_OFFICER = "{5117311FB822FD1F}Prefabs/Characters/Factions/OPFOR/USSR_Army/Character_USSR_Officer.et";
+
+	protected static ref map<string, ref Resource> s_mResources = new map<string, ref Resource>();
+	protected static ref array<string> s_aWarmQueue = {};
+	protected static ref set<string> s_sQueued = new set<string>();
+	protected static bool s_bWarming;
+
+	protected static int s_iHits;
+	protected static int s_iMisses;
+	protected static int s_iWarmLoads;
+	protected static int s_iFailed;
+
+	//------------------------------------------------------------------------------------------------
+	//! Cached Resource for `prefab`, loading and keeping it on a miss. Null if it doesn't load.
+	static Resource Load(string prefab)
+	{
+		if (prefab.IsEmpty())
+			return null;
+
+		Resource res;
+		if (s_mResources.Find(prefab, res))
+		{
+			s_iHits++;
+			return res;
+		}
+
+		s_iMisses++;
+		if (IA_Log.Allow(IA_LogCategory.General, "PrefabCache.Miss", 5000))
+			IA_Log.Write(IA_LogCategory.General, "PrefabCache cold load: " + prefab);
+		return Store(prefab);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Queues every prefab an AO against `areaFaction` can spawn: group bases, squads,
+	//! civilians, the faction's character catalog and the vehicle catalog.
+	static void Warm(Faction areaFaction)
+	{
+		Queue(GROUP_CIV);
+		Queue(GROUP_USSR_BASE);
+		Queue(GROUP_US_BASE);
+		Queue(GROUP_FIA_BASE);
+		Queue(HVT_OFFICER);
+
+		for (int st = IA_SquadType.Riflemen; st <= IA_SquadType.Antitank; st++)
+		{
+			Queue(IA_SquadResourceName_US(st));
+			Queue(IA_SquadResourceName_USSR(st));
+		}
+
+		foreach (string civ : s_IA_CivList)
+		{
+			Queue(civ);
+		}
+
+		QueueCharacterCatalog(areaFaction);
+
+		array<IA_Faction> vehicleFactions = {IA_Faction.USSR, IA_Faction.US, IA_Faction.CIV};
+		foreach (IA_Faction vehicleFaction : vehicleFactions)
+		{
+			array<string> vehicles = IA_VehicleCatalog.GetVehiclePrefabList(vehicleFaction, areaFaction);
+			foreach (string vehicle : vehicles)
+			{
+				Queue(vehicle);
+			}
+		}
+
+		if (!s_bWarming && !s_aWarmQueue.IsEmpty())
+		{
+			s_bWarming = true;
+			GetGame().GetCallqueue().CallLater(WarmTick, 0, true);
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static bool IsWarming()
+	{
+		return s_bWarming;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static int GetCachedCount()
+	{
+		return s_mResources.Count();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static int GetHits()
+	{
+		return s_iHits;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static int GetMisses()
+	{
+		return s_iMisses;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! One line for the admin performance readout.
+	static string GetReportLine()
+	{
+		return string.Format("PrefabCache  cached %1  hits %2  misses %3  warmed %4  failed %5  pending %6",
+			s_mResources.Count(), s_iHits, s_iMisses, s_iWarmLoads, s_iFailed, s_aWarmQueue.Count());
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static void QueueCharacterCatalog(Faction areaFaction)
+	{
+		SCR_Faction scrFaction = SCR_Faction.Cast(areaFaction);
+		if (!scrFaction)
+			return;
+
+		SCR_EntityCatalog entityCatalog = scrFaction.GetFactionEntityCatalogOfType(EEntityCatalogType.CHARACTER, true);
+		if (!entityCatalog)
+			return;
+
+		array<EEditableEntityLabel> noLabels = {};
+		array<SCR_EntityCatalogEntry> entries = {};
+		entityCatalog.GetFullFilteredEntityList(entries, noLabels, noLabels);
+		foreach (SCR_EntityCatalogEntry entry : entries)
+		{
+			Queue(entry.GetPrefab());
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static void Queue(string prefab)
+	{
+		if (prefab.IsEmpty() || s_mResources.Contains(prefab) || s_sQueued.Contains(prefab))
+			return;
+
+		s_sQueued.Insert(prefab);
+		s_aWarmQueue.Insert(prefab);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static Resource Store(string prefab)
+	{
+		Resource res = Resource.Load(prefab);
+		if (!res || !res.IsValid())
+		{
+			s_iFailed++;
+			return null;
+		}
+
+		s_mResources.Insert(prefab, res);
+		return res;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static void WarmTick()
+	{
+		int loaded = 0;
+		while (loaded < WARM_PER_FRAME && !s_aWarmQueue.IsEmpty())
+		{
+			int last = s_aWarmQueue.Count() - 1;
+			string prefab = s_aWarmQueue[last];
+			s_aWarmQueue.Remove(last);
+			s_sQueued.RemoveItem(prefab);
+
+			// A spawn may have loaded it on a miss since it was queued.
+			if (s_mResources.Contains(prefab))
+				continue;
+
+			Store(prefab);
+			s_iWarmLoads++;
+			loaded++;
+		}
+
+		if (!s_aWarmQueue.IsEmpty())
+			return;
+
+		s_bWarming = false;
+		GetGame().GetCallqueue().Remove(WarmTick);
+		if (IA_Log.IsOn(IA_LogCategory.General))
+			IA_Log.Write(IA_LogCategory.General, GetReportLine());
+	}
+};
@@ -0,0 +1,320 @@
+///////////////////////////////////////////////////////////////////////
+// IA_Profiler - per-subsystem frame-time sampling
+///////////////////////////////////////////////////////////////////////
+
+//! Rolling timings for one subsystem (or one subsystem in one area).
+//! Keeps the last WINDOW samples in a ring with a running sum; min/avg/p95/max are over
+//! that window. Samples are whole milliseconds, so min/p95 mostly read 0 or 1 for cheap
+//! subsystems, while max and p95 are what catch hitches.
+class IA_ProfilerStat
+{
+	static const int WINDOW = 256;
+
+	string m_sName;
+	string m_sArea;
+	int m_iCalls;
+	protected ref array<int> m_aSamples = {};
+	protected int m_iNext;
+	protected int m_iWindowSum;
+	// Per-area children of a subsystem stat; null on area stats.
+	ref map<string, ref IA_ProfilerStat> m_mAreas;
+
+	void IA_ProfilerStat(string name, string area = "")
+	{
+		m_sName = name;
+		m_sArea = area;
+	}
+
+	void Add(int ms)
+	{
+		m_iCalls++;
+		m_iWindowSum += ms;
+		if (m_aSamples.Count() < WINDOW)
+		{
+			m_aSamples.Insert(ms);
+			return;
+		}
+		m_iWindowSum -= m_aSamples[m_iNext];
+		m_aSamples[m_iNext] = ms;
+		m_iNext = (m_iNext + 1) % WINDOW;
+	}
+
+	int GetSampleCount()
+	{
+		return m_aSamples.Count();
+	}
+
+	//! Fills min/avg/p95/max (ms) over the window. Sorting happens here, not per sample.
+	void Summarize(out int minMs, out float avgMs, out int p95Ms, out int maxMs)
+	{
+		minMs = 0;
+		avgMs = 0;
+		p95Ms = 0;
+		maxMs = 0;
+		int count = m_aSamples.Count();
+		if (count == 0)
+			return;
+
+		array<int> sorted = {};
+		sorted.Copy(m_aSamples);
+		sorted.Sort();
+
+		minMs = sorted[0];
+		maxMs = sorted[count - 1];
+		avgMs = m_iWindowSum / (float)count;
+		p95Ms = sorted[Math.Min(count - 1, (int)Math.Floor(count * 0.95))];
+	}
+
+	//! Window cost used to rank rows in the readout.
+	int GetWindowTotal()
+	{
+		return m_iWindowSum;
+	}
+}
+
+//! Server-side instrumentation. Wrap an entry point with
+//!     int t = IA_Profiler.Begin();
+//!     ...work...
+//!     IA_Profiler.End("Subsystem", t, areaName);
+//! Timings use System.GetTickCount(), so single samples are whole milliseconds;
+//! averages over the window still resolve sub-millisecond costs.
+//! Off by default; admins switch it on and off from the perf page. Callers that would
+//! build a label or area string check IsEnabled() first.
+class IA_Profiler
+{
+	static const int REPORT_ROWS = 14;
+	static const int CSV_INTERVAL_MS = 60000;
+	static const string CSV_DIR = "$profile:MikesInvadeAndAnnex";
+	static const string CSV_PATH = "$profile:MikesInvadeAndAnnex/perf.csv";
+
+	protected static bool s_bEnabled = false;
+	protected static bool s_bCsvEnabled = false;
+	protected static ref map<string, ref IA_ProfilerStat> s_mStats = new map<string, ref IA_ProfilerStat>();
+
+	// Client side: last report received from the server for the admin menu.
+	protected static ref array<string> s_aLastReport = {};
+	protected static ref ScriptInvoker s_OnReport;
+
+	//------------------------------------------------------------------------------------------------
+	static int Begin()
+	{
+		if (!s_bEnabled)
+			return 0;
+		return System.GetTickCount();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static void End(string subsystem, int startMs, string area = "")
+	{
+		if (!s_bEnabled)
+			return;
+
+		int ms = System.GetTickCount() - startMs;
+		IA_ProfilerStat stat = s_mStats.Get(subsystem);
+		if (!stat)
+		{
+			stat = new IA_ProfilerStat(subsystem);
+			s_mStats.Insert(subsystem, stat);
+		}
+		stat.Add(ms);
+
+		if (area.IsEmpty())
+			return;
+
+		if (!stat.m_mAreas)
+			stat.m_mAreas = new map<string, ref IA_ProfilerStat>();
+		IA_ProfilerStat areaStat = stat.m_mAreas.Get(area);
+		if (!areaStat)
+		{
+			areaStat = new IA_ProfilerStat(subsystem, area);
+			stat.m_mAreas.Insert(area, areaStat);
+		}
+		areaStat.Add(ms);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Turning sampling off also stops the CSV, which would otherwise keep writing stale rows.
+	static void SetEnabled(bool enabled)
+	{
+		s_bEnabled = enabled;
+		if (!enabled)
+			SetCsvEnabled(false);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static bool IsEnabled()
+	{
+		return s_bEnabled;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static void Reset()
+	{
+		s_mStats.Clear();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Starts or stops appending a snapshot to perf.csv every CSV_INTERVAL_MS.
+	static void SetCsvEnabled(bool enabled)
+	{
+		if (s_bCsvEnabled == enabled)
+			return;
+
+		s_bCsvEnabled = enabled;
+		if (enabled)
+		{
+			s_bEnabled = true;
+			GetGame().GetCallqueue().CallLater(WriteCsv, CSV_INTERVAL_MS, true);
+		}
+		else
+			GetGame().GetCallqueue().Remove(WriteCsv);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static bool IsCsvEnabled()
+	{
+		return s_bCsvEnabled;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Subsystems first, then their heaviest areas, ordered by window cost. One line per row.
+	static void BuildReport(notnull array<string> lines, int maxRows = REPORT_ROWS)
+	{
+		lines.Clear();
+
+		array<IA_ProfilerStat> rows = {};
+		foreach (string name, IA_ProfilerStat stat : s_mStats)
+		{
+			rows.Insert(stat);
+		}
+		SortByCost(rows);
+
+		array<IA_ProfilerStat> areaRows = {};
+		foreach (IA_ProfilerStat subsystem : rows)
+		{
+			if (!subsystem.m_mAreas)
+				continue;
+			foreach (string area, IA_ProfilerStat areaStat : subsystem.m_mAreas)
+			{
+				areaRows.Insert(areaStat);
+			}
+		}
+		SortByCost(areaRows);
+
+		foreach (IA_ProfilerStat areaRow : areaRows)
+		{
+			rows.Insert(areaRow);
+		}
+
+		int count = Math.Min(rows.Count(), maxRows);
+		for (int i = 0; i < count; i++)
+		{
+			lines.Insert(FormatRow(rows[i]));
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static string FormatRow(IA_ProfilerStat stat)
+	{
+		string label = stat.m_sName;
+		if (!stat.m_sArea.IsEmpty())
+			label = label + " @ " + stat.m_sArea;
+
+		int minMs;
+		float avgMs;
+		int p95Ms;
+		int maxMs;
+		stat.Summarize(minMs, avgMs, p95Ms, maxMs);
+
+		return string.Format("%1  n=%2  min %3  avg %4  p95 %5  max %6 ms", label, stat.m_iCalls, minMs, avgMs.ToString(-1, 2), p95Ms, maxMs);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Insertion sort, heaviest first; row counts are small.
+	protected static void SortByCost(notnull array<IA_ProfilerStat> rows)
+	{
+		int count = rows.Count();
+		for (int i = 1; i < count; i++)
+		{
+			IA_ProfilerStat current = rows[i];
+			int cost = current.GetWindowTotal();
+			int j = i - 1;
+			while (j >= 0 && rows[j].GetWindowTotal() < cost)
+			{
+				rows[j + 1] = rows[j];
+				j--;
+			}
+			rows[j + 1] = current;
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static void WriteCsv()
+	{
+		FileIO.MakeDirectory(CSV_DIR);
+		bool writeHeader = !FileIO.FileExists(CSV_PATH);
+
+		FileHandle file = FileIO.OpenFile(CSV_PATH, FileMode.APPEND);
+		if (!file)
+		{
+			Print("[IA][Profiler] Failed to open " + CSV_PATH, LogLevel.ERROR);
+			return;
+		}
+
+		if (writeHeader)
+			file.WriteLine("time_s,subsystem,area,calls,min_ms,avg_ms,p95_ms,max_ms");
+
+		int timeS = System.GetUnixTime();
+		foreach (string name, IA_ProfilerStat stat : s_mStats)
+		{
+			file.WriteLine(CsvRow(timeS, stat));
+			if (!stat.m_mAreas)
+				continue;
+			foreach (string area, IA_ProfilerStat areaStat : stat.m_mAreas)
+			{
+				file.WriteLine(CsvRow(timeS, areaStat));
+			}
+		}
+		file.Close();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static string CsvRow(int timeS, IA_ProfilerStat stat)
+	{
+		string area = stat.m_sArea;
+		area.Replace(",", " ");
+
+		int minMs;
+		float avgMs;
+		int p95Ms;
+		int maxMs;
+		stat.Summarize(minMs, avgMs, p95Ms, maxMs);
+
+		return string.Format("%1,%2,%3,%4,%5,%6,%7,%8", timeS, stat.m_sName, area, stat.m_iCalls, minMs, avgMs.ToString(-1, 3), p95Ms, maxMs);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Client: report text received from the server.
+	static void ReceiveReport(string report, bool enabled, bool csvEnabled)
+	{
+		s_bEnabled = enabled;
+		s_bCsvEnabled = csvEnabled;
+		s_aLastReport.Clear();
+		report.Split("\n", s_aLastReport, true);
+		GetOnReport().Invoke();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static array<string> GetLastReport()
+	{
+		return s_aLastReport;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static ScriptInvoker GetOnReport()
+	{
+		if (!s_OnReport)
+			s_OnReport = new ScriptInvoker();
+		return s_OnReport;
+	}
+}
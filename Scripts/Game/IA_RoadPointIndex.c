@@ -0,0 +1,277 @@
+///////////////////////////////////////////////////////////////////////
+// IA_RoadPointIndex - road points of the active area group on a grid
+///////////////////////////////////////////////////////////////////////
+
+//! Every road point around the active area group, bucketed into CELL_SIZE_M
+//! cells. Built once when the group activates (IA_MissionInitializer.ProceedToNextZone)
+//! so spawn code stops calling GetRoadsInAABB + GetPoints per query.
+//! Points are stored cell by cell: cell c owns m_points[m_cellStart[c] .. m_cellStart[c + 1] - 1].
+//! Queries only walk the cells their circle overlaps and allocate nothing; random
+//! picks use reservoir sampling. Distances are measured in XZ.
+class IA_RoadPointIndex
+{
+	static const float CELL_SIZE_M = 100.0;
+	// Past the group's own radius: covers the 1200 m road search and inbound spawn rings.
+	static const float BOUNDS_MARGIN_M = 1500.0;
+
+	protected static ref IA_RoadPointIndex s_instance;
+
+	protected int m_groupNumber = -1;
+	protected float m_minX;
+	protected float m_minZ;
+	protected float m_maxX;
+	protected float m_maxZ;
+	protected int m_cellsX;
+	protected int m_cellsZ;
+	protected ref array<int> m_cellStart = {};
+	protected ref array<vector> m_points = {};
+
+	//------------------------------------------------------------------------------------------------
+	//! Rebuilds the index around `groupNumber`. Drops it if the group or road network is missing.
+	static void Build(int groupNumber)
+	{
+		int startMs = IA_Profiler.Begin();
+		s_instance = null;
+
+		vector center = IA_AreaMarker.CalculateGroupCenterPoint(groupNumber);
+		if (center == vector.Zero)
+			return;
+
+		SCR_AIWorld aiWorld = SCR_AIWorld.Cast(GetGame().GetAIWorld());
+		if (!aiWorld)
+			return;
+		RoadNetworkManager roadMngr = aiWorld.GetRoadNetworkManager();
+		if (!roadMngr)
+			return;
+
+		IA_RoadPointIndex index = new IA_RoadPointIndex();
+		index.m_groupNumber = groupNumber;
+		float halfSize = IA_AreaMarker.CalculateGroupRadius(groupNumber) + BOUNDS_MARGIN_M;
+		index.m_minX = center[0] - halfSize;
+		index.m_minZ = center[2] - halfSize;
+		index.m_maxX = center[0] + halfSize;
+		index.m_maxZ = center[2] + halfSize;
+		index.m_cellsX = Math.Max(1, Math.Ceil((index.m_maxX - index.m_minX) / CELL_SIZE_M));
+		index.m_cellsZ = Math.Max(1, Math.Ceil((index.m_maxZ - index.m_minZ) / CELL_SIZE_M));
+
+		array<BaseRoad> roads = {};
+		vector aabbMin = Vector(index.m_minX, center[1] - 1000, index.m_minZ);
+		vector aabbMax = Vector(index.m_maxX, center[1] + 1000, index.m_maxZ);
+		roadMngr.GetRoadsInAABB(aabbMin, aabbMax, roads);
+
+		array<vector> raw = {};
+		array<int> rawCells = {};
+		array<vector> roadPoints = {};
+		foreach (BaseRoad road : roads)
+		{
+			if (!road)
+				continue;
+
+			roadPoints.Clear();
+			road.GetPoints(roadPoints);
+			foreach (vector point : roadPoints)
+			{
+				int cell = index.CellOf(point[0], point[2]);
+				if (cell < 0)
+					continue;
+				raw.Insert(point);
+				rawCells.Insert(cell);
+			}
+		}
+
+		index.Layout(raw, rawCells);
+		s_instance = index;
+
+		IA_Profiler.End("RoadPointIndex.Build", startMs);
+		if (IA_Log.IsOn(IA_LogCategory.Area))
+			IA_Log.Write(IA_LogCategory.Area, string.Format("Road index for group %1: %2 points from %3 roads, %4x%5 cells", groupNumber, raw.Count(), roads.Count(), index.m_cellsX, index.m_cellsZ));
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static void Clear()
+	{
+		s_instance = null;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! The index if it is built for `groupNumber` (-1 = any) and holds the whole circle, else null.
+	//! A covering index is authoritative: no point found means there is no road there.
+	static IA_RoadPointIndex GetIfCovers(vector center, float radius, int groupNumber = -1)
+	{
+		if (!s_instance)
+			return null;
+		if (groupNumber >= 0 && groupNumber != s_instance.m_groupNumber)
+			return null;
+		if (!s_instance.Covers(center, radius))
+			return null;
+		return s_instance;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	bool Covers(vector center, float radius)
+	{
+		return center[0] - radius >= m_minX && center[0] + radius <= m_maxX
+			&& center[2] - radius >= m_minZ && center[2] + radius <= m_maxZ;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	int GetGroupNumber()
+	{
+		return m_groupNumber;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	int GetPointCount()
+	{
+		return m_points.Count();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Uniformly random road point with minRadius <= distance <= maxRadius, or vector.Zero.
+	vector RandomInAnnulus(vector center, float minRadius, float maxRadius)
+	{
+		float minSq = minRadius * minRadius;
+		float maxSq = maxRadius * maxRadius;
+		int cx0 = CellX(center[0] - maxRadius);
+		int cx1 = CellX(center[0] + maxRadius);
+		int cz0 = CellZ(center[2] - maxRadius);
+		int cz1 = CellZ(center[2] + maxRadius);
+
+		vector picked = vector.Zero;
+		int seen = 0;
+		for (int cz = cz0; cz <= cz1; cz++)
+		{
+			for (int cx = cx0; cx <= cx1; cx++)
+			{
+				int cell = cz * m_cellsX + cx;
+				int end = m_cellStart[cell + 1];
+				for (int i = m_cellStart[cell]; i < end; i++)
+				{
+					vector point = m_points[i];
+					float distSq = vector.DistanceSqXZ(center, point);
+					if (distSq < minSq || distSq > maxSq)
+						continue;
+
+					seen++;
+					if (Math.RandomInt(0, seen) == 0)
+						picked = point;
+				}
+			}
+		}
+		return picked;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	vector RandomInRadius(vector center, float radius)
+	{
+		return RandomInAnnulus(center, 0, radius);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Closest road point within maxRadius, or vector.Zero. Walks rings of cells outward
+	//! and stops once no closer point can exist.
+	vector Nearest(vector center, float maxRadius)
+	{
+		int ccx = CellX(center[0]);
+		int ccz = CellZ(center[2]);
+		int maxRing = Math.Ceil(maxRadius / CELL_SIZE_M) + 1;
+		float maxSq = maxRadius * maxRadius;
+
+		vector best = vector.Zero;
+		float bestSq = -1;
+		for (int ring = 0; ring <= maxRing; ring++)
+		{
+			for (int dz = -ring; dz <= ring; dz++)
+			{
+				int cz = ccz + dz;
+				if (cz < 0 || cz >= m_cellsZ)
+					continue;
+
+				// Inner rows only contribute their two edge cells.
+				int step = 1;
+				if (dz != -ring && dz != ring)
+					step = 2 * ring;
+
+				for (int dx = -ring; dx <= ring; dx += step)
+				{
+					int cx = ccx + dx;
+					if (cx < 0 || cx >= m_cellsX)
+						continue;
+
+					int cell = cz * m_cellsX + cx;
+					int end = m_cellStart[cell + 1];
+					for (int i = m_cellStart[cell]; i < end; i++)
+					{
+						float distSq = vector.DistanceSqXZ(center, m_points[i]);
+						if (distSq > maxSq)
+							continue;
+						if (bestSq < 0 || distSq < bestSq)
+						{
+							bestSq = distSq;
+							best = m_points[i];
+						}
+					}
+				}
+			}
+
+			// Cells of the next ring are at least ring * CELL_SIZE_M away.
+			float ringReach = ring * CELL_SIZE_M;
+			if (bestSq >= 0 && ringReach * ringReach >= bestSq)
+				break;
+		}
+		return best;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected int CellOf(float x, float z)
+	{
+		if (x < m_minX || x > m_maxX || z < m_minZ || z > m_maxZ)
+			return -1;
+		return CellZ(z) * m_cellsX + CellX(x);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected int CellX(float x)
+	{
+		int cx = Math.Floor((x - m_minX) / CELL_SIZE_M);
+		return Math.ClampInt(cx, 0, m_cellsX - 1);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected int CellZ(float z)
+	{
+		int cz = Math.Floor((z - m_minZ) / CELL_SIZE_M);
+		return Math.ClampInt(cz, 0, m_cellsZ - 1);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Counting sort of the raw points into cell order.
+	protected void Layout(notnull array<vector> raw, notnull array<int> rawCells)
+	{
+		int cellCount = m_cellsX * m_cellsZ;
+		m_cellStart.Resize(cellCount + 1);
+		for (int c = 0; c <= cellCount; c++)
+		{
+			m_cellStart[c] = 0;
+		}
+
+		foreach (int rawCell : rawCells)
+		{
+			m_cellStart[rawCell + 1] = m_cellStart[rawCell + 1] + 1;
+		}
+		for (int c = 0; c < cellCount; c++)
+		{
+			m_cellStart[c + 1] = m_cellStart[c + 1] + m_cellStart[c];
+		}
+
+		array<int> fill = {};
+		fill.Copy(m_cellStart);
+		m_points.Resize(raw.Count());
+		foreach (int i, vector point : raw)
+		{
+			int cell = rawCells[i];
+			m_points[fill[cell]] = point;
+			fill[cell] = fill[cell] + 1;
+		}
+	}
+};
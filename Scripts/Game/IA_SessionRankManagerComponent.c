@@ -1,5 +1,8 @@
 //------------------------------------------------------------------------------------------------
 //! Server-authoritative session ranks. RAM only — gone on restart. No API / DB.
+//! Clients get a full bit-packed table in RplLoad when they join, then versioned deltas
+//! that carry only the changed fields of changed players. A client that misses a delta
+//! gets the full table again through its own player controller.
 //------------------------------------------------------------------------------------------------
 [ComponentEditorProps(category: "Invade & Annex/Components", description: "Current-session rank board (resets on restart).")]
 class IA_SessionRankManagerComponentClass : SCR_BaseGameModeComponentClass
@@ -9,16 +12,44 @@ class IA_SessionRankManagerComponentClass : SCR_BaseGameModeComponentClass
 class IA_SessionRankManagerComponent : SCR_BaseGameModeComponent
 {
 	protected static const int REPLICATE_DELAY_MS = 1200;
+	// Per player: at most one full-table resync in this window; later asks wait for its end.
+	protected static const int RESYNC_MIN_INTERVAL_MS = 10000;
+	// Client: a resync ask with no snapshot after this long may be repeated. Longer than
+	// RESYNC_MIN_INTERVAL_MS, which the server may hold an answer for.
+	protected static const int RESYNC_TIMEOUT_MS = 20000;
 	protected static const int XP_KILL = 15;
 	protected static const int XP_HVT = 75;
 	protected static const int XP_HVT_GUARD = 25;
 
-	[RplProp(onRplName: "OnReplicated")]
-	protected string m_sJson;
+	// Delta record field bits. A record is a header int (slot << FIELD_BITS | mask) followed
+	// by one int per set bit, in this order. NEW and NAME values index the strings array.
+	protected static const int FIELD_NEW = 1;
+	protected static const int FIELD_NAME = 2;
+	protected static const int FIELD_KILLS = 4;
+	protected static const int FIELD_DEATHS = 8;
+	protected static const int FIELD_HVT = 16;
+	protected static const int FIELD_GUARD = 32;
+	protected static const int FIELD_OBJ = 64;
+	protected static const int FIELD_SCORE = 128;
+	protected static const int FIELD_RANK = 256;
+	protected static const int FIELD_NETID = 512;
+	protected static const int FIELD_ALL = 1023;
+	protected static const int FIELD_BITS = 10;
 
 	protected ref map<string, ref IA_SessionRankEntry> m_mPlayers;
 	protected ref map<string, int> m_mAoStartScore;
+	// m_aSorted stays ordered by score (desc); an award or delta moves one entry.
 	protected ref array<ref IA_SessionRankEntry> m_aSorted;
+	// Replication slots: stable per-session index of each player, same on server and clients.
+	protected ref array<IA_SessionRankEntry> m_aBySlot;
+	protected ref map<string, int> m_mSlots;
+	// Server: changed fields per playerId since the last flush.
+	protected ref map<string, int> m_mPendingMask;
+	protected int m_iVersion;
+	// Server: last resync sent per playerId, and players waiting out RESYNC_MIN_INTERVAL_MS.
+	protected ref map<int, int> m_mResyncSentMs;
+	protected ref set<int> m_ResyncQueued;
+	protected bool m_bResyncRequested;
 	protected ref ScriptInvoker m_OnUpdated;
 	protected bool m_bReplicatePending;
 	protected static IA_SessionRankManagerComponent s_Instance;
@@ -37,12 +68,6 @@ class IA_SessionRankManagerComponent : SCR_BaseGameModeComponent
 		return m_OnUpdated;
 	}
 
-	//------------------------------------------------------------------------------------------------
-	string GetCachedJson()
-	{
-		return m_sJson;
-	}
-
 	//------------------------------------------------------------------------------------------------
 	array<ref IA_SessionRankEntry> GetSorted()
 	{
@@ -120,14 +145,7 @@ class IA_SessionRankManagerComponent : SCR_BaseGameModeComponent
 		}
 
 		s_Instance = this;
-		m_mPlayers = new map<string, ref IA_SessionRankEntry>();
-		m_aSorted = new array<ref IA_SessionRankEntry>();
-
-		if (!Replication.IsServer())
-		{
-			RebuildFromJson(m_sJson);
-			GetOnUpdated().Invoke(m_sJson);
-		}
+		EnsureContainers();
 	}
 
 	//------------------------------------------------------------------------------------------------
@@ -151,6 +169,18 @@ class IA_SessionRankManagerComponent : SCR_BaseGameModeComponent
 		MarkDirty();
 	}
 
+	//------------------------------------------------------------------------------------------------
+	override void OnPlayerDisconnected(int playerId, KickCauseCode cause, int timeout)
+	{
+		super.OnPlayerDisconnected(playerId, cause, timeout);
+		if (!Replication.IsServer())
+			return;
+
+		EnsureContainers();
+		m_mResyncSentMs.Remove(playerId);
+		m_ResyncQueued.RemoveItem(playerId);
+	}
+
 	//------------------------------------------------------------------------------------------------
 	protected void RetryEnsurePlayer(int playerId)
 	{
@@ -182,8 +212,9 @@ class IA_SessionRankManagerComponent : SCR_BaseGameModeComponent
 			return;
 		}
 
-		entry.score = IA_SessionRankLadder.GetRequiredXp(next);
+		SetScore(entry, IA_SessionRankLadder.GetRequiredXp(next));
 		entry.rankId = next;
+		MarkChanged(entry, FIELD_SCORE | FIELD_RANK);
 		FlushNow();
 	}
 
@@ -324,13 +355,37 @@ class IA_SessionRankManagerComponent : SCR_BaseGameModeComponent
 		if (!entry)
 			return;
 
+		int mask = 0;
+		if (kills != 0)
+			mask = mask | FIELD_KILLS;
+		if (deaths != 0)
+			mask = mask | FIELD_DEATHS;
+		if (hvt != 0)
+			mask = mask | FIELD_HVT;
+		if (guard != 0)
+			mask = mask | FIELD_GUARD;
+		if (obj != 0)
+			mask = mask | FIELD_OBJ;
+		if (xp != 0)
+			mask = mask | FIELD_SCORE;
+
 		entry.kills = entry.kills + kills;
 		entry.deaths = entry.deaths + deaths;
 		entry.hvt_kills = entry.hvt_kills + hvt;
 		entry.hvt_guard_kills = entry.hvt_guard_kills + guard;
 		entry.obj_score = entry.obj_score + obj;
-		entry.score = entry.score + xp;
-		entry.rankId = IA_SessionRankLadder.GetRankByXp(entry.score);
+		SetScore(entry, entry.score + xp);
+
+		int rankId = IA_SessionRankLadder.GetRankByXp(entry.score);
+		if (rankId != entry.rankId)
+		{
+			entry.rankId = rankId;
+			mask = mask | FIELD_RANK;
+		}
+
+		if (mask == 0)
+			return;
+		MarkChanged(entry, mask);
 		MarkDirty();
 	}
 
@@ -346,8 +401,11 @@ class IA_SessionRankManagerComponent : SCR_BaseGameModeComponent
 
 		string name = GetGame().GetPlayerManager().GetPlayerName(playerId);
 		IA_SessionRankEntry entry = EnsurePlayer(guid, name);
-		if (entry)
+		if (entry && entry.netId != playerId)
+		{
 			entry.netId = playerId;
+			MarkChanged(entry, FIELD_NETID);
+		}
 		return entry;
 	}
 
@@ -357,16 +415,25 @@ class IA_SessionRankManagerComponent : SCR_BaseGameModeComponent
 		if (playerId.IsEmpty())
 			return null;
 
-		if (!m_mPlayers)
-			m_mPlayers = new map<string, ref IA_SessionRankEntry>();
+		EnsureContainers();
 
 		IA_SessionRankEntry existing = m_mPlayers.Get(playerId);
 		if (existing)
 		{
 			if (!playerName.IsEmpty())
-				existing.PlayerName = IA_SanitizePlayerName(playerName);
+			{
+				string sanitized = IA_SanitizePlayerName(playerName);
+				if (sanitized != existing.PlayerName)
+				{
+					existing.PlayerName = sanitized;
+					MarkChanged(existing, FIELD_NAME);
+				}
+			}
 			if (existing.netId <= 0)
+			{
 				existing.netId = ResolveNetId(playerId);
+				MarkChanged(existing, FIELD_NETID);
+			}
 			return existing;
 		}
 
@@ -381,10 +448,125 @@ class IA_SessionRankManagerComponent : SCR_BaseGameModeComponent
 		entry.score = 0;
 		entry.rankId = SCR_ECharacterRank.PRIVATE;
 		entry.netId = ResolveNetId(playerId);
-		m_mPlayers.Insert(playerId, entry);
+		AddEntry(entry, m_aBySlot.Count());
+		MarkChanged(entry, FIELD_ALL);
 		return entry;
 	}
 
+	//------------------------------------------------------------------------------------------------
+	protected void AddEntry(IA_SessionRankEntry entry, int slot)
+	{
+		m_mPlayers.Insert(entry.playerId, entry);
+		m_mSlots.Insert(entry.playerId, slot);
+		if (m_aBySlot.Count() <= slot)
+			m_aBySlot.Resize(slot + 1);
+		m_aBySlot[slot] = entry;
+		m_aSorted.InsertAt(entry, UpperBound(entry.score));
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Server: queue `fields` of this player for the next delta.
+	protected void MarkChanged(IA_SessionRankEntry entry, int fields)
+	{
+		int pending = 0;
+		m_mPendingMask.Find(entry.playerId, pending);
+		m_mPendingMask.Set(entry.playerId, pending | fields);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void EnsureContainers()
+	{
+		if (!m_mPlayers)
+			m_mPlayers = new map<string, ref IA_SessionRankEntry>();
+		if (!m_aSorted)
+			m_aSorted = new array<ref IA_SessionRankEntry>();
+		if (!m_aBySlot)
+			m_aBySlot = new array<IA_SessionRankEntry>();
+		if (!m_mSlots)
+			m_mSlots = new map<string, int>();
+		if (!m_mPendingMask)
+			m_mPendingMask = new map<string, int>();
+		if (!m_mResyncSentMs)
+			m_mResyncSentMs = new map<int, int>();
+		if (!m_ResyncQueued)
+			m_ResyncQueued = new set<int>();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void ResetTable()
+	{
+		EnsureContainers();
+		m_mPlayers.Clear();
+		m_aSorted.Clear();
+		m_aBySlot.Clear();
+		m_mSlots.Clear();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! First index whose score is <= `score` (m_aSorted is descending).
+	protected int LowerBound(int score)
+	{
+		int lo = 0;
+		int hi = m_aSorted.Count();
+		while (lo < hi)
+		{
+			int mid = (lo + hi) / 2;
+			if (m_aSorted[mid].score > score)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		return lo;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! First index whose score is < `score`; inserting there keeps ties in arrival order.
+	protected int UpperBound(int score)
+	{
+		int lo = 0;
+		int hi = m_aSorted.Count();
+		while (lo < hi)
+		{
+			int mid = (lo + hi) / 2;
+			if (m_aSorted[mid].score >= score)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		return lo;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Changes an entry's score and moves it to its new place in m_aSorted.
+	protected void SetScore(IA_SessionRankEntry entry, int newScore)
+	{
+		int oldScore = entry.score;
+		if (newScore == oldScore)
+			return;
+
+		// Find the entry inside its (usually tiny) run of equal scores.
+		int index = -1;
+		int count = m_aSorted.Count();
+		int i;
+		for (i = LowerBound(oldScore); i < count; i++)
+		{
+			if (m_aSorted[i].score != oldScore)
+				break;
+			if (m_aSorted[i] == entry)
+			{
+				index = i;
+				break;
+			}
+		}
+
+		ref IA_SessionRankEntry held = entry;
+		if (index != -1)
+			m_aSorted.RemoveOrdered(index);
+
+		held.score = newScore;
+		m_aSorted.InsertAt(held, UpperBound(newScore));
+	}
+
 	//------------------------------------------------------------------------------------------------
 	protected int ResolveNetId(string guid)
 	{
@@ -431,106 +613,337 @@ class IA_SessionRankManagerComponent : SCR_BaseGameModeComponent
 		if (!Replication.IsServer())
 			return;
 
-		RebuildSorted();
-		m_sJson = BuildJson();
-		Replication.BumpMe();
-		GetOnUpdated().Invoke(m_sJson);
+		EnsureContainers();
+		if (m_mPendingMask.IsEmpty())
+			return;
+
+		array<int> packed = {};
+		array<string> strings = {};
+		foreach (string id, int mask : m_mPendingMask)
+		{
+			IA_SessionRankEntry entry = m_mPlayers.Get(id);
+			if (entry)
+				AppendRecord(entry, m_mSlots.Get(id), mask, packed, strings);
+		}
+		m_mPendingMask.Clear();
+
+		int baseVersion = m_iVersion;
+		m_iVersion++;
+		Rpc(RpcDo_ApplyDelta, baseVersion, packed, strings);
+
+		GetOnUpdated().Invoke();
 	}
 
 	//------------------------------------------------------------------------------------------------
-	protected void OnReplicated()
+	protected void AppendRecord(IA_SessionRankEntry e, int slot, int mask, notnull array<int> packed, notnull array<string> strings)
 	{
-		RebuildFromJson(m_sJson);
-		GetOnUpdated().Invoke(m_sJson);
+		packed.Insert((slot << FIELD_BITS) | mask);
+		if (mask & FIELD_NEW)
+			packed.Insert(strings.Insert(e.playerId));
+		if (mask & FIELD_NAME)
+			packed.Insert(strings.Insert(e.PlayerName));
+		if (mask & FIELD_KILLS)
+			packed.Insert(e.kills);
+		if (mask & FIELD_DEATHS)
+			packed.Insert(e.deaths);
+		if (mask & FIELD_HVT)
+			packed.Insert(e.hvt_kills);
+		if (mask & FIELD_GUARD)
+			packed.Insert(e.hvt_guard_kills);
+		if (mask & FIELD_OBJ)
+			packed.Insert(e.obj_score);
+		if (mask & FIELD_SCORE)
+			packed.Insert(e.score);
+		if (mask & FIELD_RANK)
+			packed.Insert(e.rankId);
+		if (mask & FIELD_NETID)
+			packed.Insert(e.netId);
 	}
 
 	//------------------------------------------------------------------------------------------------
-	protected void RebuildFromJson(string jsonData)
+	//! Server: player `playerId` missed a delta. Sends them the full table, at most once per
+	//! RESYNC_MIN_INTERVAL_MS; an ask inside that window is answered when it ends.
+	void RequestFullResync(int playerId)
 	{
-		m_aSorted = new array<ref IA_SessionRankEntry>();
-		if (!jsonData || jsonData.IsEmpty())
+		if (!Replication.IsServer())
 			return;
 
-		JsonLoadContext jsonContext = new JsonLoadContext();
-		if (!jsonContext.LoadFromString(jsonData))
-		{
-			Print("[IA][SessionRank] Failed to load session JSON.", LogLevel.ERROR);
+		EnsureContainers();
+		if (m_ResyncQueued.Contains(playerId))
 			return;
+
+		int lastMs;
+		if (m_mResyncSentMs.Find(playerId, lastMs))
+		{
+			int waitMs = RESYNC_MIN_INTERVAL_MS - (System.GetTickCount() - lastMs);
+			if (waitMs > 0)
+			{
+				m_ResyncQueued.Insert(playerId);
+				GetGame().GetCallqueue().CallLater(this.SendQueuedResync, waitMs, false, playerId);
+				return;
+			}
 		}
+		SendResync(playerId);
+	}
 
-		ref array<ref IA_SessionRankEntry> loaded = new array<ref IA_SessionRankEntry>();
-		if (!jsonContext.ReadValue("", loaded))
+	//------------------------------------------------------------------------------------------------
+	protected void SendQueuedResync(int playerId)
+	{
+		// Dropped from the queue when the player disconnected.
+		if (!m_ResyncQueued.Contains(playerId))
+			return;
+
+		m_ResyncQueued.RemoveItem(playerId);
+		SendResync(playerId);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Server: full table to one player's controller, at the version after any pending delta.
+	protected void SendResync(int playerId)
+	{
+		SCR_PlayerController pc = SCR_PlayerController.Cast(GetGame().GetPlayerManager().GetPlayerController(playerId));
+		if (!pc)
 		{
-			Print("[IA][SessionRank] Failed to read session entries.", LogLevel.ERROR);
+			// The client's own timeout lets it ask again.
+			Print("[IA][SessionRank] Resync for player " + playerId.ToString() + " dropped: no player controller.", LogLevel.WARNING);
 			return;
 		}
 
-		m_aSorted = loaded;
+		// Broadcast what is pending first so the snapshot version lines up with later deltas.
+		FlushNow();
+
+		array<int> packed = {};
+		array<string> strings = {};
+		int slotCount = m_aBySlot.Count();
+		for (int slot = 0; slot < slotCount; slot++)
+		{
+			if (m_aBySlot[slot])
+				AppendRecord(m_aBySlot[slot], slot, FIELD_ALL, packed, strings);
+		}
+
+		m_mResyncSentMs.Set(playerId, System.GetTickCount());
+		pc.IA_SendSessionRankSnapshot(m_iVersion, packed, strings);
 	}
 
 	//------------------------------------------------------------------------------------------------
-	protected void RebuildSorted()
+	//! Client: full table from SendResync, replacing the local one.
+	void ApplySnapshot(int version, array<int> packed, array<string> strings)
 	{
-		m_aSorted = new array<ref IA_SessionRankEntry>();
-		if (!m_mPlayers)
-			return;
+		ResetTable();
+		ApplyRecords(packed, strings);
+		m_iVersion = version;
+		m_bResyncRequested = false;
+		GetGame().GetCallqueue().Remove(this.OnResyncTimeout);
+		GetOnUpdated().Invoke();
+	}
 
-		foreach (string id, IA_SessionRankEntry entry : m_mPlayers)
+	//------------------------------------------------------------------------------------------------
+	[RplRpc(RplChannel.Reliable, RplRcver.Broadcast)]
+	protected void RpcDo_ApplyDelta(int baseVersion, array<int> packed, array<string> strings)
+	{
+		if (baseVersion > m_iVersion)
 		{
-			if (entry)
-				m_aSorted.Insert(entry);
+			// Missed a delta; ask for the whole table and wait for it.
+			RequestResyncFromServer();
+			return;
 		}
+		if (baseVersion < m_iVersion)
+			return; // Already contained in the join snapshot or a resync.
 
-		int n = m_aSorted.Count();
-		int i;
-		int j;
-		for (i = 0; i < n; i++)
+		ApplyRecords(packed, strings);
+		m_iVersion = baseVersion + 1;
+		GetOnUpdated().Invoke();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void RequestResyncFromServer()
+	{
+		if (m_bResyncRequested)
+			return;
+
+		SCR_PlayerController pc = SCR_PlayerController.Cast(GetGame().GetPlayerController());
+		if (!pc)
+			return;
+
+		m_bResyncRequested = true;
+		Print("[IA][SessionRank] Delta version gap, requesting full table.", LogLevel.WARNING);
+		pc.IA_AskSessionRankResync();
+		GetGame().GetCallqueue().CallLater(this.OnResyncTimeout, RESYNC_TIMEOUT_MS, false);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Client: no snapshot arrived; the next delta with a version gap asks again.
+	protected void OnResyncTimeout()
+	{
+		if (!m_bResyncRequested)
+			return;
+
+		m_bResyncRequested = false;
+		Print("[IA][SessionRank] Full table request timed out.", LogLevel.WARNING);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void ApplyRecords(array<int> packed, array<string> strings)
+	{
+		EnsureContainers();
+		int count = packed.Count();
+		int p = 0;
+		while (p < count)
 		{
-			for (j = 0; j < n - 1; j++)
+			int header = packed[p];
+			p++;
+			int slot = header >> FIELD_BITS;
+			int mask = header & FIELD_ALL;
+
+			IA_SessionRankEntry entry = null;
+			if (slot < m_aBySlot.Count())
+				entry = m_aBySlot[slot];
+
+			if (mask & FIELD_NEW)
 			{
-				if (m_aSorted[j].score >= m_aSorted[j + 1].score)
-					continue;
+				string id = strings[packed[p]];
+				p++;
+				if (!entry)
+				{
+					entry = new IA_SessionRankEntry();
+					entry.playerId = id;
+					entry.rankId = SCR_ECharacterRank.PRIVATE;
+					AddEntry(entry, slot);
+				}
+			}
 
-				ref IA_SessionRankEntry tmp = m_aSorted[j];
-				m_aSorted[j] = m_aSorted[j + 1];
-				m_aSorted[j + 1] = tmp;
+			if (!entry)
+			{
+				// Unknown slot: the record can't be applied, skip its values and resync.
+				p += CountFields(mask);
+				RequestResyncFromServer();
+				continue;
+			}
+
+			if (mask & FIELD_NAME)
+			{
+				entry.PlayerName = strings[packed[p]];
+				p++;
+			}
+			if (mask & FIELD_KILLS)
+			{
+				entry.kills = packed[p];
+				p++;
+			}
+			if (mask & FIELD_DEATHS)
+			{
+				entry.deaths = packed[p];
+				p++;
+			}
+			if (mask & FIELD_HVT)
+			{
+				entry.hvt_kills = packed[p];
+				p++;
+			}
+			if (mask & FIELD_GUARD)
+			{
+				entry.hvt_guard_kills = packed[p];
+				p++;
+			}
+			if (mask & FIELD_OBJ)
+			{
+				entry.obj_score = packed[p];
+				p++;
+			}
+			if (mask & FIELD_SCORE)
+			{
+				SetScore(entry, packed[p]);
+				p++;
+			}
+			if (mask & FIELD_RANK)
+			{
+				entry.rankId = packed[p];
+				p++;
+			}
+			if (mask & FIELD_NETID)
+			{
+				entry.netId = packed[p];
+				p++;
 			}
 		}
 	}
 
 	//------------------------------------------------------------------------------------------------
-	protected string BuildJson()
+	//! Number of value ints that follow a header with this mask (NEW included).
+	protected static int CountFields(int mask)
 	{
-		string json = "[";
-		int count = 0;
-		if (m_aSorted)
-			count = m_aSorted.Count();
+		int fields = 0;
+		int bit = 1;
+		while (bit <= FIELD_ALL)
+		{
+			if (mask & bit)
+				fields++;
+			bit = bit << 1;
+		}
+		return fields;
+	}
 
-		int i;
-		for (i = 0; i < count; i++)
+	//------------------------------------------------------------------------------------------------
+	//! Full table for joining clients, in slot order so slots line up with later deltas.
+	override bool RplSave(ScriptBitWriter writer)
+	{
+		EnsureContainers();
+		writer.Write(m_iVersion, 32);
+
+		int slotCount = m_aBySlot.Count();
+		writer.Write(slotCount, 16);
+		for (int slot = 0; slot < slotCount; slot++)
 		{
-			IA_SessionRankEntry e = m_aSorted[i];
-			if (!e)
+			IA_SessionRankEntry e = m_aBySlot[slot];
+			bool present = e != null;
+			writer.WriteBool(present);
+			if (!present)
 				continue;
 
-			if (i > 0)
-				json = json + ",";
-
-			json = json + "{";
-			json = json + "\"playerId\": \"" + IA_JsonEscape(e.playerId) + "\",";
-			json = json + "\"PlayerName\": \"" + IA_JsonEscape(e.PlayerName) + "\",";
-			json = json + "\"kills\": " + e.kills.ToString() + ",";
-			json = json + "\"deaths\": " + e.deaths.ToString() + ",";
-			json = json + "\"hvt_kills\": " + e.hvt_kills.ToString() + ",";
-			json = json + "\"hvt_guard_kills\": " + e.hvt_guard_kills.ToString() + ",";
-			json = json + "\"obj_score\": " + e.obj_score.ToString() + ",";
-			json = json + "\"score\": " + e.score.ToString() + ",";
-			json = json + "\"rankId\": " + e.rankId.ToString() + ",";
-			json = json + "\"netId\": " + e.netId.ToString();
-			json = json + "}";
+			writer.WriteString(e.playerId);
+			writer.WriteString(e.PlayerName);
+			writer.Write(e.kills, 16);
+			writer.Write(e.deaths, 16);
+			writer.Write(e.hvt_kills, 16);
+			writer.Write(e.hvt_guard_kills, 16);
+			writer.Write(e.obj_score, 32);
+			writer.Write(e.score, 32);
+			writer.Write(e.rankId, 8);
+			writer.Write(e.netId, 16);
+		}
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override bool RplLoad(ScriptBitReader reader)
+	{
+		ResetTable();
+
+		int version;
+		int slotCount;
+		if (!reader.Read(version, 32) || !reader.Read(slotCount, 16))
+			return false;
+
+		for (int slot = 0; slot < slotCount; slot++)
+		{
+			bool present;
+			if (!reader.ReadBool(present))
+				return false;
+			if (!present)
+				continue;
+
+			IA_SessionRankEntry e = new IA_SessionRankEntry();
+			if (!reader.ReadString(e.playerId) || !reader.ReadString(e.PlayerName))
+				return false;
+			if (!reader.Read(e.kills, 16) || !reader.Read(e.deaths, 16) || !reader.Read(e.hvt_kills, 16) || !reader.Read(e.hvt_guard_kills, 16))
+				return false;
+			if (!reader.Read(e.obj_score, 32) || !reader.Read(e.score, 32) || !reader.Read(e.rankId, 8) || !reader.Read(e.netId, 16))
+				return false;
+			AddEntry(e, slot);
 		}
 
-		json = json + "]";
-		return json;
+		m_iVersion = version;
+		GetOnUpdated().Invoke();
+		return true;
 	}
 }
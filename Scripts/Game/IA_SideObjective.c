@@ -161,7 +161,7 @@ class IA_SideObjective
         task.SetTaskState(SCR_ETaskState.CREATED);
         
         // Use a global notification helper to inform players
-        IA_Game.S_TriggerGlobalNotification("SideTaskCreated", title);
+        IA_Game.S_TriggerGlobalNotification(IA_NotificationType.SideTaskCreated, title);
         
         return task;
     }
@@ -178,7 +178,7 @@ class IA_SideObjective
             SCR_ExtendedTask extendedTask = SCR_ExtendedTask.Cast(m_PlayerTask);
             if (extendedTask)
                 extendedTask.SetTaskState(SCR_ETaskState.COMPLETED);
-            IA_Game.S_TriggerGlobalNotification("SideTaskCompleted", "Side Objective Completed. The HVT has been eliminated. Enemy artillery and QRF is unavailable for 20 minutes.");
+            IA_Game.S_TriggerGlobalNotification(IA_NotificationType.SideTaskCompleted, "Side Objective Completed. The HVT has been eliminated. Enemy artillery and QRF is unavailable for 20 minutes.");
         }
     }
 
@@ -569,7 +569,7 @@ class IA_AssassinationObjective : IA_SideObjective
 			
             // Notify players
 
-            IA_Game.S_TriggerGlobalNotification("GeneratorDestroyed", "Side Objective: Generator Destroyed! Enemy reinforcements disabled!");
+            IA_Game.S_TriggerGlobalNotification(IA_NotificationType.GeneratorDestroyed, "Side Objective: Generator Destroyed! Enemy reinforcements disabled!");
         }
     }
     
@@ -588,7 +588,7 @@ class IA_AssassinationObjective : IA_SideObjective
             return;
         }
 
-        Resource vehRes = Resource.Load(vehiclePrefabPath);
+        Resource vehRes = IA_PrefabCache.Load(vehiclePrefabPath);
         if (!vehRes)
         {
             Print(string.Format("[IA_AssassinationObjective] Failed to load escape vehicle resource: %1", vehiclePrefabPath), LogLevel.ERROR);
@@ -690,7 +690,7 @@ class IA_AssassinationObjective : IA_SideObjective
                 if (m_Generator && !m_GeneratorDestroyed)
                     notifText += " Destroy the Generator to stop them.";
 
-                IA_Game.S_TriggerGlobalNotification("ReinforcementsCalled", notifText);
+                IA_Game.S_TriggerGlobalNotification(IA_NotificationType.ReinforcementsCalled, notifText);
             }
         }
 
@@ -724,7 +724,7 @@ class IA_AssassinationObjective : IA_SideObjective
                 Print("[IA_AssassinationObjective] HVT reached escape point. Starting 30s extraction timer.", LogLevel.NORMAL);
                 
                 // Notify players
-                IA_Game.S_TriggerGlobalNotification("HVTEscaping", "Side Objective: HVT has reached the extraction point! Eliminate them immediately!");
+                IA_Game.S_TriggerGlobalNotification(IA_NotificationType.HVTEscaping, "Side Objective: HVT has reached the extraction point! Eliminate them immediately!");
             }
             
             if (m_bHVTEscaping)
@@ -740,7 +740,7 @@ class IA_AssassinationObjective : IA_SideObjective
                 {
                     // Timer finished, HVT successfully escaped
                     Print("[IA_AssassinationObjective] HVT successfully extracted – objective failed.", LogLevel.NORMAL);
-					IA_Game.S_TriggerGlobalNotification("HVTEscaped", "Side Objective: The HVT has Escaped! Mission Failed.");
+					IA_Game.S_TriggerGlobalNotification(IA_NotificationType.HVTEscaped, "Side Objective: The HVT has Escaped! Mission Failed.");
 
                     Fail();
                 }
@@ -1030,7 +1030,7 @@ class IA_AssassinationObjective : IA_SideObjective
         Print(string.Format("[IA_AssassinationObjective] Escape task created at %1", m_EscapePoint.ToString()), LogLevel.NORMAL);
 
         // Notify players
-        IA_Game.S_TriggerGlobalNotification("HVTPreparingEscape", "Side Objective: The HVT is preparing to make their escape!");
+        IA_Game.S_TriggerGlobalNotification(IA_NotificationType.HVTPreparingEscape, "Side Objective: The HVT is preparing to make their escape!");
 
         m_EscapeTaskCreated = true;
     }
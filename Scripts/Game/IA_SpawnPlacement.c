@@ -18,23 +18,7 @@ class IA_SpawnPlacement
 		if (!positions)
 			return;
 
-		positions.Clear();
-
-		PlayerManager playerManager = GetGame().GetPlayerManager();
-		if (!playerManager)
-			return;
-
-		array<int> playerIds = {};
-		playerManager.GetPlayers(playerIds);
-
-		int idCount = playerIds.Count();
-		int i;
-		for (i = 0; i < idCount; i++)
-		{
-			IEntity playerEntity = playerManager.GetPlayerControlledEntity(playerIds[i]);
-			if (playerEntity)
-				positions.Insert(playerEntity.GetOrigin());
-		}
+		positions.Copy(IA_PlayerSnapshot.Get().GetLivePositions());
 	}
 
 	static bool IsLegalInbound(vector pos, vector center, array<vector> players, float centerMax, bool applyPlayerMax)
@@ -195,8 +179,7 @@ class IA_SpawnPlacement
 		if (center == vector.Zero)
 			return vector.Zero;
 
-		ref array<vector> players = new array<vector>();
-		CollectPlayerPositions(players);
+		array<vector> players = IA_PlayerSnapshot.Get().GetLivePositions();
 
 		bool fightNear = IsFightNearAo(center, players);
 		vector found;
@@ -226,6 +209,9 @@ class IA_SpawnPlacement
 	static bool TryInfantryPhase(vector center, array<vector> players, float minR, float maxR, int sectorIndex, bool applyPlayerMax, out vector outPos)
 	{
 		outPos = vector.Zero;
+		if (IA_SpawnPointPool.Get().Take(center, false, sectorIndex, maxR, applyPlayerMax, players, outPos))
+			return true;
+
 		int attempt;
 		for (attempt = 0; attempt < SAME_RADIUS_TRIES; attempt++)
 		{
@@ -248,8 +234,7 @@ class IA_SpawnPlacement
 		if (center == vector.Zero)
 			return vector.Zero;
 
-		ref array<vector> players = new array<vector>();
-		CollectPlayerPositions(players);
+		array<vector> players = IA_PlayerSnapshot.Get().GetLivePositions();
 
 		bool fightNear = IsFightNearAo(center, players);
 		vector found;
@@ -279,6 +264,9 @@ class IA_SpawnPlacement
 	static bool TryVehiclePhase(vector center, array<vector> players, int roadGroup, float minR, float maxR, int sectorIndex, bool applyPlayerMax, out vector outPos)
 	{
 		outPos = vector.Zero;
+		if (IA_SpawnPointPool.Get().Take(center, true, sectorIndex, maxR, applyPlayerMax, players, outPos))
+			return true;
+
 		int attempt;
 		for (attempt = 0; attempt < SAME_RADIUS_TRIES; attempt++)
 		{
@@ -0,0 +1,322 @@
+///////////////////////////////////////////////////////////////////////
+// IA_SpawnPointPool - pre-validated inbound spawn candidates
+///////////////////////////////////////////////////////////////////////
+
+//! Validated candidates for one sector of one pool: spawn position and when it was validated.
+class IA_SpawnCandidateBucket
+{
+	ref array<vector> m_points = {};
+	ref array<int> m_bornMs = {};
+	// Sectors that keep failing (water, no roads) back off instead of sampling every frame.
+	int m_failures;
+	int m_retryAtMs;
+
+	//------------------------------------------------------------------------------------------------
+	bool NeedsFill(int nowMs)
+	{
+		return m_points.Count() < IA_SpawnPointPool.PER_SECTOR && nowMs >= m_retryAtMs;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void RecordAttempt(bool produced, int nowMs)
+	{
+		if (produced)
+		{
+			m_failures = 0;
+			return;
+		}
+
+		m_failures++;
+		if (m_failures < IA_SpawnPointPool.MAX_FAILURES)
+			return;
+
+		m_failures = 0;
+		m_retryAtMs = nowMs + IA_SpawnPointPool.FAILURE_BACKOFF_MS;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void Add(vector point, int nowMs)
+	{
+		m_points.Insert(point);
+		m_bornMs.Insert(nowMs);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void RemoveAt(int index)
+	{
+		m_points.Remove(index);
+		m_bornMs.Remove(index);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void DropOlderThan(int cutoffMs)
+	{
+		for (int i = m_points.Count() - 1; i >= 0; i--)
+		{
+			if (m_bornMs[i] < cutoffMs)
+				RemoveAt(i);
+		}
+	}
+}
+
+//! Infantry and vehicle candidates around one spawn center (an area origin or defend target),
+//! one bucket per sector as IA_SpawnPlacement.IsInSector numbers them.
+class IA_SpawnPointPoolArea
+{
+	vector m_center;
+	int m_roadGroup;
+	int m_lastTouchedMs;
+	ref array<ref IA_SpawnCandidateBucket> m_infantry = {};
+	ref array<ref IA_SpawnCandidateBucket> m_vehicles = {};
+
+	//------------------------------------------------------------------------------------------------
+	void IA_SpawnPointPoolArea(vector center, int roadGroup)
+	{
+		m_center = center;
+		m_roadGroup = roadGroup;
+		for (int s = 0; s < IA_SpawnPointPool.SECTORS; s++)
+		{
+			m_infantry.Insert(new IA_SpawnCandidateBucket());
+			m_vehicles.Insert(new IA_SpawnCandidateBucket());
+		}
+	}
+}
+
+//! Producer for IA_SpawnPlacement. While an AO is live its areas Touch() their spawn
+//! centers from AreaUpkeep; the pool samples, snaps and empty-checks a few candidates
+//! per frame until every sector holds PER_SECTOR of each kind. Candidates are checked
+//! against the center only when produced; Take() rechecks them against the current
+//! players, so a wave or QRF spawn only needs the (cheap) legality test.
+//! Pools that stop being touched are dropped.
+class IA_SpawnPointPool
+{
+	static const int SECTORS = 4;
+	static const int PER_SECTOR = 3;
+	static const int SAMPLES_PER_FRAME = 2;
+	static const int MAX_AGE_MS = 90000;
+	static const int IDLE_DROP_MS = 10000;
+	static const int MAX_FAILURES = 8;
+	static const int FAILURE_BACKOFF_MS = 5000;
+	static const float SAME_CENTER_M = 1.0;
+
+	protected static ref IA_SpawnPointPool s_instance;
+
+	protected ref array<ref IA_SpawnPointPoolArea> m_pools = {};
+	protected ref array<vector> m_noPlayers = {};
+	protected bool m_running;
+	protected int m_cursor;
+
+	// Counters for diagnostics
+	protected int m_taken;
+	protected int m_missed;
+	protected int m_produced;
+
+	//------------------------------------------------------------------------------------------------
+	static IA_SpawnPointPool Get()
+	{
+		if (!s_instance)
+			s_instance = new IA_SpawnPointPool();
+		return s_instance;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Keeps a pool for `center` alive and filling.
+	void Touch(vector center, int roadGroup)
+	{
+		if (center == vector.Zero)
+			return;
+
+		int now = System.GetTickCount();
+		IA_SpawnPointPoolArea pool = Find(center);
+		if (!pool)
+		{
+			pool = new IA_SpawnPointPoolArea(center, roadGroup);
+			m_pools.Insert(pool);
+		}
+		pool.m_roadGroup = roadGroup;
+		pool.m_lastTouchedMs = now;
+		Start();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	IA_SpawnPointPoolArea Find(vector center)
+	{
+		float sameSq = SAME_CENTER_M * SAME_CENTER_M;
+		foreach (IA_SpawnPointPoolArea pool : m_pools)
+		{
+			if (vector.DistanceSqXZ(pool.m_center, center) <= sameSq)
+				return pool;
+		}
+		return null;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! A pooled candidate for `center` that passes IsLegalInbound right now, removed from the pool.
+	//! sectorIndex -1 accepts any sector. False when the pool has nothing usable.
+	bool Take(vector center, bool vehicle, int sectorIndex, float centerMax, bool applyPlayerMax, array<vector> players, out vector outPos)
+	{
+		outPos = vector.Zero;
+		IA_SpawnPointPoolArea pool = Find(center);
+		if (!pool)
+			return false;
+
+		int cutoff = System.GetTickCount() - MAX_AGE_MS;
+		int firstSector = sectorIndex;
+		int sectorCount = 1;
+		if (sectorIndex < 0)
+		{
+			firstSector = IA_Game.rng.RandInt(0, SECTORS);
+			sectorCount = SECTORS;
+		}
+
+		for (int n = 0; n < sectorCount; n++)
+		{
+			IA_SpawnCandidateBucket bucket;
+			int sector = (firstSector + n) % SECTORS;
+			if (vehicle)
+				bucket = pool.m_vehicles[sector];
+			else
+				bucket = pool.m_infantry[sector];
+
+			bucket.DropOlderThan(cutoff);
+			int count = bucket.m_points.Count();
+			for (int i = 0; i < count; i++)
+			{
+				vector candidate = bucket.m_points[i];
+				if (!IA_SpawnPlacement.IsLegalInbound(candidate, center, players, centerMax, applyPlayerMax))
+					continue;
+
+				bucket.RemoveAt(i);
+				outPos = candidate;
+				m_taken++;
+				Start();
+				return true;
+			}
+		}
+
+		m_missed++;
+		return false;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! One line for the admin performance readout.
+	string GetReportLine()
+	{
+		return string.Format("SpawnPointPool  pools %1  taken %2  missed %3  produced %4", m_pools.Count(), m_taken, m_missed, m_produced);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void Start()
+	{
+		if (m_running)
+			return;
+		m_running = true;
+		GetGame().GetCallqueue().CallLater(Tick, 0, true);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Spends up to SAMPLES_PER_FRAME samples on the emptiest buckets, round-robin over pools.
+	protected void Tick()
+	{
+		int now = System.GetTickCount();
+		for (int p = m_pools.Count() - 1; p >= 0; p--)
+		{
+			if (now - m_pools[p].m_lastTouchedMs > IDLE_DROP_MS)
+				m_pools.Remove(p);
+		}
+
+		int poolCount = m_pools.Count();
+		int samples = 0;
+		for (int visited = 0; visited < poolCount && samples < SAMPLES_PER_FRAME; visited++)
+		{
+			m_cursor = (m_cursor + 1) % poolCount;
+			IA_SpawnPointPoolArea pool = m_pools[m_cursor];
+			samples += FillPool(pool, now, SAMPLES_PER_FRAME - samples);
+		}
+
+		if (samples > 0)
+			return;
+
+		// Everything full (or nothing to fill); Take() and Touch() restart the producer.
+		m_running = false;
+		GetGame().GetCallqueue().Remove(Tick);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected int FillPool(IA_SpawnPointPoolArea pool, int nowMs, int budget)
+	{
+		int cutoff = nowMs - MAX_AGE_MS;
+		int used = 0;
+		for (int sector = 0; sector < SECTORS && used < budget; sector++)
+		{
+			IA_SpawnCandidateBucket infantry = pool.m_infantry[sector];
+			infantry.DropOlderThan(cutoff);
+			if (infantry.NeedsFill(nowMs))
+			{
+				infantry.RecordAttempt(ProduceInfantry(pool, sector, nowMs), nowMs);
+				used++;
+			}
+
+			if (used >= budget)
+				break;
+
+			IA_SpawnCandidateBucket vehicles = pool.m_vehicles[sector];
+			vehicles.DropOlderThan(cutoff);
+			if (vehicles.NeedsFill(nowMs))
+			{
+				vehicles.RecordAttempt(ProduceVehicle(pool, sector, nowMs), nowMs);
+				used++;
+			}
+		}
+		return used;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! True if the sample landed in `sector`'s bucket.
+	protected bool ProduceInfantry(IA_SpawnPointPoolArea pool, int sector, int nowMs)
+	{
+		float maxR = IA_SpawnPlacement.HARD_CAP_FROM_CENTER_M;
+		vector sample = IA_SpawnPlacement.SamplePolar(pool.m_center, IA_SpawnPlacement.CENTER_MIN_M, maxR, sector);
+		vector snapped;
+		if (!IA_SpawnPlacement.TrySnapInfantryPoint(sample, pool.m_center, m_noPlayers, maxR, false, snapped))
+			return false;
+
+		// Snapping can move the point across a sector edge.
+		int actual = SectorOf(snapped, pool.m_center);
+		if (pool.m_infantry[actual].m_points.Count() >= PER_SECTOR)
+			return false;
+
+		pool.m_infantry[actual].Add(snapped, nowMs);
+		m_produced++;
+		return actual == sector;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Roads come from the whole annulus; true if the pick landed in `sector`'s bucket.
+	protected bool ProduceVehicle(IA_SpawnPointPoolArea pool, int sector, int nowMs)
+	{
+		vector roadPos = IA_VehicleManager.FindRoadInAnnulus(pool.m_center, IA_SpawnPlacement.CENTER_MIN_M, IA_SpawnPlacement.HARD_CAP_FROM_CENTER_M, pool.m_roadGroup);
+		if (roadPos == vector.Zero)
+			return false;
+
+		roadPos[1] = GetGame().GetWorld().GetSurfaceY(roadPos[0], roadPos[2]);
+		int actual = SectorOf(roadPos, pool.m_center);
+		if (pool.m_vehicles[actual].m_points.Count() >= PER_SECTOR)
+			return false;
+
+		pool.m_vehicles[actual].Add(roadPos, nowMs);
+		m_produced++;
+		return actual == sector;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static int SectorOf(vector pos, vector center)
+	{
+		for (int s = 0; s < SECTORS - 1; s++)
+		{
+			if (IA_SpawnPlacement.IsInSector(pos, center, s))
+				return s;
+		}
+		return SECTORS - 1;
+	}
+};
@@ -0,0 +1,345 @@
+///////////////////////////////////////////////////////////////////////
+// IA_SpawnQueue - frame-budgeted AI group and character creation
+///////////////////////////////////////////////////////////////////////
+
+//! Lower value is served first. Requests of equal priority run in enqueue order.
+enum IA_SpawnPriority
+{
+	HVT,
+	DefendWave,
+	Reinforcement,
+	Garrison,
+	Civilian
+};
+
+//! One queued piece of spawn work. Step() does at most one entity spawn (a group
+//! entity or one character) and returns true once the request is finished.
+class IA_SpawnRequest
+{
+	IA_SpawnPriority m_priority = IA_SpawnPriority.Garrison;
+	// Earliest tick (ms) the request may run; 0 = as soon as there is room.
+	int m_notBeforeMs;
+	int m_sequence;
+	bool m_cancelled;
+	protected ref ScriptInvoker m_OnComplete;
+
+	//------------------------------------------------------------------------------------------------
+	bool Step()
+	{
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Invoked with the request once its last step ran; not for cancelled requests.
+	ScriptInvoker GetOnComplete()
+	{
+		if (!m_OnComplete)
+			m_OnComplete = new ScriptInvoker();
+		return m_OnComplete;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void NotifyComplete()
+	{
+		if (m_OnComplete)
+			m_OnComplete.Invoke(this);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Read every time the queue picks work, so a group can be promoted after it was queued.
+	IA_SpawnPriority GetPriority()
+	{
+		return m_priority;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Group the request is building, if any; used by IA_SpawnQueue.Cancel.
+	IA_AiGroup GetGroup()
+	{
+		return null;
+	}
+}
+
+//! Staggered character spawn of a group whose SCR_AIGroup already exists.
+class IA_GroupUnitsSpawnRequest : IA_SpawnRequest
+{
+	protected IA_AiGroup m_group;
+	protected bool m_hostileCivilians;
+
+	//------------------------------------------------------------------------------------------------
+	void IA_GroupUnitsSpawnRequest(IA_AiGroup group, bool hostileCivilians = false)
+	{
+		m_group = group;
+		m_hostileCivilians = hostileCivilians;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override bool Step()
+	{
+		if (!m_group)
+			return true;
+		if (m_hostileCivilians)
+			return m_group.SpawnNextHostileCivilianUnit();
+		return m_group.SpawnNextUnit();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override IA_SpawnPriority GetPriority()
+	{
+		if (!m_group)
+			return m_priority;
+		return m_group.GetSpawnPriority();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override IA_AiGroup GetGroup()
+	{
+		return m_group;
+	}
+}
+
+//! Ambient civilian: group entity and its single character in one step.
+class IA_CivilianSpawnRequest : IA_SpawnRequest
+{
+	protected IA_AiGroup m_group;
+
+	//------------------------------------------------------------------------------------------------
+	void IA_CivilianSpawnRequest(IA_AiGroup group)
+	{
+		m_group = group;
+		m_priority = IA_SpawnPriority.Civilian;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override bool Step()
+	{
+		if (m_group)
+			m_group.Spawn();
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override IA_AiGroup GetGroup()
+	{
+		return m_group;
+	}
+}
+
+//! Server-side singleton. Each frame it runs the highest-priority ready request,
+//! one spawn at a time, until MAX_SPAWNS_PER_FRAME spawns or FRAME_BUDGET_MS is
+//! used. The first spawn of a frame always runs so nothing starves. The tick is
+//! only registered while requests are waiting, and while every waiting request is
+//! delayed it sleeps until the earliest one is due instead of running each frame.
+class IA_SpawnQueue
+{
+	static const int MAX_SPAWNS_PER_FRAME = 4;
+	static const int FRAME_BUDGET_MS = 2;
+
+	protected static ref IA_SpawnQueue s_instance;
+
+	protected ref array<ref IA_SpawnRequest> m_requests = {};
+	protected int m_nextSequence;
+	protected bool m_running;
+	// Tick count the one-shot Tick is due at while all requests are delayed; 0 = ticking each frame.
+	protected int m_wakeAtMs;
+
+	// Counters for diagnostics
+	protected int m_spawnSteps;
+	protected int m_completedRequests;
+	protected int m_cancelledRequests;
+	protected int m_peakDepth;
+
+	//------------------------------------------------------------------------------------------------
+	static IA_SpawnQueue Get()
+	{
+		if (!s_instance)
+			s_instance = new IA_SpawnQueue();
+		return s_instance;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Queues `request`; with delayMs > 0 it is held back at least that long.
+	void Enqueue(IA_SpawnRequest request, int delayMs = 0)
+	{
+		if (!request)
+			return;
+
+		request.m_sequence = m_nextSequence;
+		m_nextSequence++;
+		if (delayMs > 0)
+			request.m_notBeforeMs = System.GetTickCount() + delayMs;
+		m_requests.Insert(request);
+		m_peakDepth = Math.Max(m_peakDepth, m_requests.Count());
+
+		Schedule(request.m_notBeforeMs);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Makes sure Tick runs no later than `dueMs`: each frame once it is due, else one call then.
+	protected void Schedule(int dueMs)
+	{
+		if (m_running && (m_wakeAtMs == 0 || m_wakeAtMs <= dueMs))
+			return;
+
+		ScriptCallQueue queue = GetGame().GetCallqueue();
+		if (m_running)
+			queue.Remove(Tick);
+		m_running = true;
+
+		int waitMs = dueMs - System.GetTickCount();
+		if (waitMs <= 0)
+		{
+			m_wakeAtMs = 0;
+			queue.CallLater(Tick, 0, true);
+			return;
+		}
+
+		m_wakeAtMs = dueMs;
+		queue.CallLater(Tick, waitMs, false);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected int GetEarliestDueMs()
+	{
+		int earliest = m_requests[0].m_notBeforeMs;
+		foreach (IA_SpawnRequest request : m_requests)
+		{
+			if (request.m_notBeforeMs < earliest)
+				earliest = request.m_notBeforeMs;
+		}
+		return earliest;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Drops every queued request building `group`.
+	void Cancel(IA_AiGroup group)
+	{
+		if (!group)
+			return;
+
+		foreach (IA_SpawnRequest request : m_requests)
+		{
+			if (!request.m_cancelled && request.GetGroup() == group)
+			{
+				request.m_cancelled = true;
+				m_cancelledRequests++;
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	int GetDepth()
+	{
+		return m_requests.Count();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	int GetPeakDepth()
+	{
+		return m_peakDepth;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	int GetSpawnSteps()
+	{
+		return m_spawnSteps;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	int GetCompletedRequests()
+	{
+		return m_completedRequests;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	int GetCancelledRequests()
+	{
+		return m_cancelledRequests;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void Tick()
+	{
+		for (int i = m_requests.Count() - 1; i >= 0; i--)
+		{
+			if (m_requests[i].m_cancelled)
+				m_requests.Remove(i);
+		}
+
+		int frameStart = System.GetTickCount();
+		int spawns = 0;
+
+		while (spawns < MAX_SPAWNS_PER_FRAME)
+		{
+			if (spawns > 0 && System.GetTickCount() - frameStart >= FRAME_BUDGET_MS)
+				break;
+
+			int index = PickNext(frameStart);
+			if (index < 0)
+				break;
+
+			IA_SpawnRequest request = m_requests[index];
+			bool done = request.Step();
+			spawns++;
+			if (!done)
+				continue;
+
+			// Look it up again: a step may have queued new requests.
+			int doneIndex = m_requests.Find(request);
+			if (doneIndex >= 0)
+				m_requests.Remove(doneIndex);
+			m_completedRequests++;
+			request.NotifyComplete();
+		}
+
+		m_spawnSteps += spawns;
+		if (spawns > 0)
+			IA_Profiler.End("SpawnQueue", frameStart);
+
+		ScriptCallQueue queue = GetGame().GetCallqueue();
+		if (m_requests.IsEmpty())
+		{
+			m_running = false;
+			m_wakeAtMs = 0;
+			queue.Remove(Tick);
+			return;
+		}
+
+		// Keep the per-frame tick while work is ready; otherwise (or after a one-shot
+		// wake) re-arm for the earliest due request.
+		int dueMs = GetEarliestDueMs();
+		if (m_wakeAtMs == 0 && dueMs <= System.GetTickCount())
+			return;
+
+		queue.Remove(Tick);
+		m_running = false;
+		m_wakeAtMs = 0;
+		Schedule(dueMs);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Index of the ready request with the best (priority, sequence), or -1.
+	protected int PickNext(int nowMs)
+	{
+		int best = -1;
+		IA_SpawnPriority bestPriority;
+		int bestSequence;
+
+		int count = m_requests.Count();
+		for (int i = 0; i < count; i++)
+		{
+			IA_SpawnRequest request = m_requests[i];
+			if (request.m_cancelled || nowMs < request.m_notBeforeMs)
+				continue;
+
+			IA_SpawnPriority priority = request.GetPriority();
+			if (best < 0 || priority < bestPriority || (priority == bestPriority && request.m_sequence < bestSequence))
+			{
+				best = i;
+				bestPriority = priority;
+				bestSequence = request.m_sequence;
+			}
+		}
+		return best;
+	}
+};
@@ -5,127 +5,62 @@ class IA_StatEvent
 
     // Base constructor removed to avoid compiler conflicts
     
-    string ToJson();
-}
-
-class IA_PlayerKillEvent : IA_StatEvent
-{
-    string m_sKillerPlayerId;
-    string m_sKillerPlayerName;
-
-    void IA_PlayerKillEvent(string killerId, string killerName)
-    {
-        m_sEventType = "PlayerKill"; // Set event type directly
-        m_sKillerPlayerId = killerId;
-        m_sKillerPlayerName = IA_SanitizePlayerName(killerName);
-    }
-
-    override string ToJson()
-    {
-        // Manual JSON serialization
-        string json = "{";
-        json = json + "\"eventType\": \"" + m_sEventType + "\",";
-        json = json + "\"killerPlayerId\": \"" + IA_JsonEscape(m_sKillerPlayerId) + "\",";
-        json = json + "\"killerPlayerName\": \"" + IA_JsonEscape(m_sKillerPlayerName) + "\"";
-        json = json + "}";
-        return json;
-    }
-}
-
-class IA_PlayerDeathEvent : IA_StatEvent
-{
-    string m_sVictimPlayerId;
-    string m_sVictimPlayerName;
-
-    void IA_PlayerDeathEvent(string victimId, string victimName)
-    {
-        m_sEventType = "PlayerDeath";
-        m_sVictimPlayerId = victimId;
-        m_sVictimPlayerName = IA_SanitizePlayerName(victimName);
-    }
-
-    override string ToJson()
-    {
-        // Manual JSON serialization
-        string json = "{";
-        json = json + "\"eventType\": \"" + m_sEventType + "\",";
-        json = json + "\"victimPlayerId\": \"" + IA_JsonEscape(m_sVictimPlayerId) + "\",";
-        json = json + "\"victimPlayerName\": \"" + IA_JsonEscape(m_sVictimPlayerName) + "\"";
-        json = json + "}";
-        return json;
-    }
-} 
+    void WriteJson(IA_JsonWriter writer);
 
-class IA_HVTKillEvent : IA_StatEvent
-{
-    string m_sKillerPlayerId;
-    string m_sKillerPlayerName;
-
-    void IA_HVTKillEvent(string killerId, string killerName)
-    {
-        m_sEventType = "HVTKill";
-        m_sKillerPlayerId = killerId;
-        m_sKillerPlayerName = IA_SanitizePlayerName(killerName);
-    }
-
-    override string ToJson()
+    string ToJson()
     {
-        // Manual JSON serialization
-        string json = "{";
-        json = json + "\"eventType\": \"" + m_sEventType + "\",";
-        json = json + "\"killerPlayerId\": \"" + IA_JsonEscape(m_sKillerPlayerId) + "\",";
-        json = json + "\"killerPlayerName\": \"" + IA_JsonEscape(m_sKillerPlayerName) + "\"";
-        json = json + "}";
-        return json;
+        IA_JsonWriter writer = new IA_JsonWriter();
+        WriteJson(writer);
+        return writer.ToString();
     }
 }
 
-class IA_HVTGuardKillEvent : IA_StatEvent
-{
-    string m_sKillerPlayerId;
-    string m_sKillerPlayerName;
-
-    void IA_HVTGuardKillEvent(string killerId, string killerName)
-    {
-        m_sEventType = "HVTGuardKill";
-        m_sKillerPlayerId = killerId;
-        m_sKillerPlayerName = IA_SanitizePlayerName(killerName);
-    }
-
-    override string ToJson()
-    {
-        // Manual JSON serialization
-        string json = "{";
-        json = json + "\"eventType\": \"" + m_sEventType + "\",";
-        json = json + "\"killerPlayerId\": \"" + IA_JsonEscape(m_sKillerPlayerId) + "\",";
-        json = json + "\"killerPlayerName\": \"" + IA_JsonEscape(m_sKillerPlayerName) + "\"";
-        json = json + "}";
-        return json;
-    }
-} 
-
-class IA_CaptureContributionEvent : IA_StatEvent
+// One player's counters for one batch window. Replaces the old one-object-per-kill
+// events (PlayerKill, PlayerDeath, HVTKill, HVTGuardKill, CaptureContribution).
+class IA_PlayerStatAggregate : IA_StatEvent
 {
     string m_sPlayerId;
     string m_sPlayerName;
-    int m_iScore;
-
-    void IA_CaptureContributionEvent(string playerId, string playerName, int score)
+    int m_iKills;
+    int m_iDeaths;
+    int m_iHvtKills;
+    int m_iHvtGuardKills;
+    int m_iCaptureScore;
+    int m_iCaptures;
+
+    void IA_PlayerStatAggregate(string playerId, string playerName)
     {
-        m_sEventType = "CaptureContribution";
+        m_sEventType = "PlayerAggregate";
         m_sPlayerId = playerId;
         m_sPlayerName = IA_SanitizePlayerName(playerName);
-        m_iScore = score;
     }
 
-    override string ToJson()
+    void SetName(string playerName)
     {
-        string json = "{";
-        json = json + "\"eventType\": \"" + m_sEventType + "\",";
-        json = json + "\"playerId\": \"" + IA_JsonEscape(m_sPlayerId) + "\",";
-        json = json + "\"playerName\": \"" + IA_JsonEscape(m_sPlayerName) + "\",";
-        json = json + "\"score\": " + m_iScore;
-        json = json + "}";
-        return json;
+        if (playerName && playerName != "")
+            m_sPlayerName = IA_SanitizePlayerName(playerName);
     }
-} 
\ No newline at end of file
+
+    override void WriteJson(IA_JsonWriter writer)
+    {
+        // Zero counters are left out to keep the batch small.
+        writer.BeginObject();
+        writer.WriteString("eventType", m_sEventType);
+        writer.WriteString("playerId", m_sPlayerId);
+        writer.WriteString("playerName", m_sPlayerName);
+        if (m_iKills > 0)
+            writer.WriteInt("kills", m_iKills);
+        if (m_iDeaths > 0)
+            writer.WriteInt("deaths", m_iDeaths);
+        if (m_iHvtKills > 0)
+            writer.WriteInt("hvtKills", m_iHvtKills);
+        if (m_iHvtGuardKills > 0)
+            writer.WriteInt("hvtGuardKills", m_iHvtGuardKills);
+        if (m_iCaptures > 0)
+        {
+            writer.WriteInt("captures", m_iCaptures);
+            writer.WriteInt("captureScore", m_iCaptureScore);
+        }
+        writer.EndObject();
+    }
+}
@@ -243,7 +243,7 @@ class IA_StatisticsMenu : MUI_MenuBase
 			}
 
 			session.GetOnUpdated().Insert(this.PopulateSessionRank);
-			PopulateSessionRank(session.GetCachedJson());
+			PopulateSessionRank();
 			return;
 		}
 
@@ -370,31 +370,19 @@ class IA_StatisticsMenu : MUI_MenuBase
 	}
 
 	//------------------------------------------------------------------------------------------------
-	void PopulateSessionRank(string jsonData)
+	void PopulateSessionRank()
 	{
 		if (!GetRuntime() || !m_Scroll)
 			return;
 
 		ClearDataRows();
 
-		if (!jsonData || jsonData.IsEmpty() || jsonData == "[]")
-			return;
-
-		JsonLoadContext jsonContext = new JsonLoadContext();
-		if (!jsonContext.LoadFromString(jsonData))
-		{
-			Print("[IA_StatisticsMenu] Failed to import session JSON.", LogLevel.ERROR);
-			return;
-		}
-
-		ref array<ref IA_SessionRankEntry> playerStats = new array<ref IA_SessionRankEntry>();
-		if (!jsonContext.ReadValue("", playerStats))
-		{
-			Print("[IA_StatisticsMenu] Failed to read session stats from JSON.", LogLevel.ERROR);
+		IA_SessionRankManagerComponent session = IA_SessionRankManagerComponent.GetInstance();
+		if (!session)
 			return;
-		}
 
-		if (playerStats.IsEmpty())
+		array<ref IA_SessionRankEntry> playerStats = session.GetSorted();
+		if (!playerStats || playerStats.IsEmpty())
 			return;
 
 		MUI_Runtime runtime = GetRuntime();
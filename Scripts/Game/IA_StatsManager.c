@@ -1,13 +1,34 @@
 // Game/IA_StatsManager.c
+// Stats are aggregated per player GUID for each BATCH_SEND_INTERVAL window and sent as
+// one record per player. Batches the backend has not accepted yet wait in an outbox
+// (capped, mirrored to $profile: while undelivered and a server GUID is configured) and
+// are replayed in order.
 class IA_StatsManager
 {
     private static ref IA_StatsManager s_Instance;
-    private ref array<ref IA_StatEvent> m_aEventQue;
     private const int BATCH_SEND_INTERVAL = 60; // seconds
+    private const int REPLAY_DELAY_MS = 2000;
+    // Hard outbox cap; the oldest batches are dropped first.
+    private const int MAX_OUTBOX_BATCHES = 120;
+    private const int MAX_OUTBOX_CHARS = 524288;
+    // A window never tracks more players than this; events for further players in the same
+    // window are dropped (counted in GetDroppedRecords and logged).
+    private const int MAX_WINDOW_PLAYERS = 512;
+    private static const string OUTBOX_DIR = "$profile:MikesInvadeAndAnnex";
+    private static const string OUTBOX_PATH = OUTBOX_DIR + "/stats_outbox.jsonl";
+
+    private ref map<string, ref IA_PlayerStatAggregate> m_mWindow;
+    private ref array<string> m_aOutbox;
+    private int m_iOutboxChars;
+    private bool m_bSendInFlight;
+    private int m_iDroppedRecords;
+    private int m_iDroppedBatches;
 
     private void IA_StatsManager()
     {
-        m_aEventQue = new array<ref IA_StatEvent>();
+        m_mWindow = new map<string, ref IA_PlayerStatAggregate>();
+        m_aOutbox = new array<string>();
+        LoadOutbox();
         GetGame().GetCallqueue().CallLater(SendBatch, BATCH_SEND_INTERVAL * 1000, true);
         Print("IA_StatsManager initialized, will send batches every " + BATCH_SEND_INTERVAL + " seconds.", LogLevel.NORMAL);
     }
@@ -27,8 +48,9 @@ class IA_StatsManager
             return;
         }
         
-        IA_PlayerKillEvent newEvent = new IA_PlayerKillEvent(killerId, killerName);
-        m_aEventQue.Insert(newEvent);
+        IA_PlayerStatAggregate record = GetRecord(killerId, killerName);
+        if (record)
+            record.m_iKills++;
         AwardSessionKill(killerId, killerName);
     }
     
@@ -40,8 +62,9 @@ class IA_StatsManager
             return;
         }
         
-        IA_PlayerDeathEvent newEvent = new IA_PlayerDeathEvent(victimId, victimName);
-        m_aEventQue.Insert(newEvent);
+        IA_PlayerStatAggregate record = GetRecord(victimId, victimName);
+        if (record)
+            record.m_iDeaths++;
         AwardSessionDeath(victimId, victimName);
     }
 
@@ -53,8 +76,9 @@ class IA_StatsManager
             return;
         }
         
-        IA_HVTKillEvent newEvent = new IA_HVTKillEvent(killerId, killerName);
-        m_aEventQue.Insert(newEvent);
+        IA_PlayerStatAggregate record = GetRecord(killerId, killerName);
+        if (record)
+            record.m_iHvtKills++;
         AwardSessionHvt(killerId, killerName);
     }
 
@@ -66,8 +90,9 @@ class IA_StatsManager
             return;
         }
         
-        IA_HVTGuardKillEvent newEvent = new IA_HVTGuardKillEvent(killerId, killerName);
-        m_aEventQue.Insert(newEvent);
+        IA_PlayerStatAggregate record = GetRecord(killerId, killerName);
+        if (record)
+            record.m_iHvtGuardKills++;
         AwardSessionHvtGuard(killerId, killerName);
     }
 
@@ -79,36 +104,192 @@ class IA_StatsManager
             return;
         }
         
-        IA_CaptureContributionEvent newEvent = new IA_CaptureContributionEvent(playerId, playerName, score);
-        m_aEventQue.Insert(newEvent);
+        IA_PlayerStatAggregate record = GetRecord(playerId, playerName);
+        if (record)
+        {
+            record.m_iCaptures++;
+            record.m_iCaptureScore = record.m_iCaptureScore + score;
+        }
         AwardSessionCapture(playerId, playerName, score);
     }
 
+    int GetOutboxCount()
+    {
+        return m_aOutbox.Count();
+    }
+
+    int GetDroppedBatches()
+    {
+        return m_iDroppedBatches;
+    }
+
+    int GetDroppedRecords()
+    {
+        return m_iDroppedRecords;
+    }
+
+    private IA_PlayerStatAggregate GetRecord(string playerId, string playerName)
+    {
+        IA_PlayerStatAggregate record = m_mWindow.Get(playerId);
+        if (record)
+        {
+            record.SetName(playerName);
+            return record;
+        }
+
+        if (m_mWindow.Count() >= MAX_WINDOW_PLAYERS)
+        {
+            m_iDroppedRecords++;
+            if (IA_Log.Allow(IA_LogCategory.General, "Stats.WindowFull", 60000, LogLevel.WARNING))
+                IA_Log.Write(IA_LogCategory.General, string.Format("Stats window full (%1 players); dropped event for %2. %3 dropped this session.", MAX_WINDOW_PLAYERS, playerId, m_iDroppedRecords), LogLevel.WARNING);
+            return null;
+        }
+
+        record = new IA_PlayerStatAggregate(playerId, playerName);
+        m_mWindow.Insert(playerId, record);
+        return record;
+    }
+
     void SendBatch()
     {
-        if (m_aEventQue.IsEmpty())
+        CloseWindow();
+        TrySendNext();
+    }
+
+    // Serializes the current window into the outbox and starts a new window.
+    private void CloseWindow()
+    {
+        if (m_mWindow.IsEmpty())
             return;
-            
-        string payload = "[";
-        int eventCount = m_aEventQue.Count();
-        for (int i = 0; i < eventCount; i++)
+
+        IA_JsonWriter writer = new IA_JsonWriter();
+        writer.BeginArray();
+        foreach (string playerId, IA_PlayerStatAggregate record : m_mWindow)
         {
-            payload = payload + m_aEventQue[i].ToJson();
-            if (i < eventCount - 1)
-            {
-                payload = payload + ",";
-            }
+            record.WriteJson(writer);
         }
-        payload = payload + "]";
-        
+        writer.EndArray();
+        string payload = writer.ToString();
+
         Print("IA_StatsManager: Constructed payload: " + payload, LogLevel.DEBUG);
-        
-        IA_ApiHandler.GetInstance().SubmitStats(payload);
-        
-        Print("IA_StatsManager: Sending batch of " + eventCount + " events.", LogLevel.NORMAL);
+        Print("IA_StatsManager: Closing batch of " + m_mWindow.Count() + " player records.", LogLevel.NORMAL);
+
+        m_mWindow.Clear();
+        m_aOutbox.Insert(payload);
+        m_iOutboxChars += payload.Length();
+        EnforceOutboxCap();
+    }
+
+    private void EnforceOutboxCap()
+    {
+        // The head may be in flight; never drop it from under the request.
+        int keep = 0;
+        if (m_bSendInFlight)
+            keep = 1;
+
+        while (m_aOutbox.Count() > keep + 1 && (m_aOutbox.Count() > MAX_OUTBOX_BATCHES || m_iOutboxChars > MAX_OUTBOX_CHARS))
+        {
+            m_iOutboxChars -= m_aOutbox[keep].Length();
+            m_aOutbox.RemoveOrdered(keep);
+            m_iDroppedBatches++;
+            Print("IA_StatsManager: Outbox full, dropped oldest stats batch.", LogLevel.WARNING);
+        }
+    }
+
+    private void TrySendNext()
+    {
+        if (m_bSendInFlight || m_aOutbox.IsEmpty())
+            return;
+
+        IA_ApiHandler api = IA_ApiHandler.GetInstance();
+        if (!api || !api.SubmitStats(m_aOutbox[0]))
+        {
+            SaveOutbox();
+            return;
+        }
+        m_bSendInFlight = true;
+    }
+
+    // Called by IA_ApiHandler when /submitStats accepted the head batch.
+    void OnBatchDelivered()
+    {
+        if (!m_bSendInFlight)
+            return;
+        m_bSendInFlight = false;
+
+        if (!m_aOutbox.IsEmpty())
+        {
+            m_iOutboxChars -= m_aOutbox[0].Length();
+            m_aOutbox.RemoveOrdered(0);
+        }
+
+        SaveOutbox();
+        if (!m_aOutbox.IsEmpty())
+            GetGame().GetCallqueue().CallLater(TrySendNext, REPLAY_DELAY_MS, false);
+    }
+
+    // Called by IA_ApiHandler when /submitStats failed; the batch stays queued for the next interval.
+    void OnBatchFailed()
+    {
+        if (!m_bSendInFlight)
+            return;
+        m_bSendInFlight = false;
+        SaveOutbox();
+    }
+
+    // One payload per line; rewritten whenever the outbox changes while undelivered batches exist.
+    // Without a server GUID nothing can ever be delivered, so batches stay in memory only
+    // (still capped) until registration supplies one.
+    private void SaveOutbox()
+    {
+        IA_ApiHandler api = IA_ApiHandler.GetInstance();
+        if (!api || !api.HasServerGuid())
+            return;
+
+        if (m_aOutbox.IsEmpty())
+        {
+            if (FileIO.FileExists(OUTBOX_PATH))
+                FileIO.DeleteFile(OUTBOX_PATH);
+            return;
+        }
+
+        FileIO.MakeDirectory(OUTBOX_DIR);
+        FileHandle file = FileIO.OpenFile(OUTBOX_PATH, FileMode.WRITE);
+        if (!file)
+        {
+            Print("IA_StatsManager: Failed to write " + OUTBOX_PATH, LogLevel.ERROR);
+            return;
+        }
+
+        foreach (string payload : m_aOutbox)
+        {
+            file.WriteLine(payload);
+        }
+        file.Close();
+    }
+
+    private void LoadOutbox()
+    {
+        if (!FileIO.FileExists(OUTBOX_PATH))
+            return;
+
+        FileHandle file = FileIO.OpenFile(OUTBOX_PATH, FileMode.READ);
+        if (!file)
+            return;
+
+        string line;
+        while (file.ReadLine(line) > -1)
+        {
+            if (line.IsEmpty())
+                continue;
+            m_aOutbox.Insert(line);
+            m_iOutboxChars += line.Length();
+        }
+        file.Close();
 
-        // Clear the queue after sending
-        m_aEventQue.Clear();
+        EnforceOutboxCap();
+        if (!m_aOutbox.IsEmpty())
+            Print("IA_StatsManager: Replaying " + m_aOutbox.Count() + " undelivered stats batches.", LogLevel.NORMAL);
     }
 
     protected void AwardSessionKill(string playerId, string playerName)
@@ -0,0 +1,248 @@
+///////////////////////////////////////////////////////////////////////
+// IA_TaskScheduler - time-budgeted server tick for game and area tasks
+///////////////////////////////////////////////////////////////////////
+
+//! Work items the scheduler knows how to dispatch.
+//! GameUpdate is game-wide; everything else runs against one IA_AreaInstance.
+enum IA_ScheduledTask
+{
+	GameUpdate,
+	AreaUpkeep,
+	Reinforcements,
+	StrengthUpdate,
+	VehicleReinforcements,
+	MilitaryOrders,
+	CivilianOrders,
+	AiAttackers,
+	VehicleManagement,
+	AIReactions
+};
+
+class IA_ScheduledTaskEntry
+{
+	IA_AreaInstance m_areaInstance; // null for game-wide tasks
+	IA_ScheduledTask m_task;
+	bool m_transient;               // transient areas ignore the active group filter
+	int m_periodMs;
+	int m_nextDueMs;
+	int m_lastCostMs;
+	bool m_removed;
+}
+
+//! Replaces the old 2s round-robin. Every task has its own period and a phase
+//! offset so areas don't line up; each frame runs due tasks until the frame
+//! budget is spent and leaves the rest due for the next frame.
+class IA_TaskScheduler
+{
+	static const int FRAME_BUDGET_MS = 3;
+	static const int GAME_UPDATE_PERIOD_MS = 2000;
+	static const int AREA_UPKEEP_PERIOD_MS = 2000;
+	// Same cadence the old 10-slot x 2s cycle gave each area task.
+	static const int AREA_TASK_PERIOD_MS = 20000;
+	static const int AREA_TASK_SLOTS = 10;
+
+	private ref array<ref IA_ScheduledTaskEntry> m_entries = {};
+	private int m_cursor = 0;
+	private bool m_running = false;
+	private bool m_hasRemoved = false;
+
+	// Counters for diagnostics
+	private int m_deferredLastFrame = 0;
+	private int m_overrunFrames = 0;
+
+	void Start()
+	{
+		if (m_running)
+			return;
+		m_running = true;
+		GetGame().GetCallqueue().CallLater(Tick, 0, true);
+	}
+
+	void Stop()
+	{
+		if (!m_running)
+			return;
+		m_running = false;
+		GetGame().GetCallqueue().Remove(Tick);
+	}
+
+	void RegisterGameTask(IA_ScheduledTask task, int periodMs)
+	{
+		AddEntry(null, task, false, periodMs, 0);
+	}
+
+	//! Registers the full task set for an area, phased like the old cycle
+	//! (Reinforcements at slot 1, StrengthUpdate at slot 2, ...) plus a random
+	//! per-area offset so several areas don't hit MilitaryOrders in one frame.
+	void RegisterArea(IA_AreaInstance inst, bool transient = false)
+	{
+		if (!inst || IsAreaRegistered(inst))
+			return;
+
+		int slotMs = AREA_TASK_PERIOD_MS / AREA_TASK_SLOTS;
+		int areaJitter = IA_Game.rng.RandInt(0, slotMs);
+
+		AddEntry(inst, IA_ScheduledTask.AreaUpkeep, transient, AREA_UPKEEP_PERIOD_MS, IA_Game.rng.RandInt(0, AREA_UPKEEP_PERIOD_MS));
+
+		int slot = 1;
+		for (int task = IA_ScheduledTask.Reinforcements; task <= IA_ScheduledTask.AIReactions; task++)
+		{
+			AddEntry(inst, task, transient, AREA_TASK_PERIOD_MS, slot * slotMs + areaJitter);
+			slot++;
+		}
+	}
+
+	void UnregisterArea(IA_AreaInstance inst)
+	{
+		if (!inst)
+			return;
+
+		foreach (IA_ScheduledTaskEntry entry : m_entries)
+		{
+			if (entry.m_areaInstance == inst)
+			{
+				entry.m_removed = true;
+				m_hasRemoved = true;
+			}
+		}
+	}
+
+	//! Drops every area registered through AddArea; transient areas stay scheduled.
+	void UnregisterGroupAreas()
+	{
+		foreach (IA_ScheduledTaskEntry entry : m_entries)
+		{
+			if (entry.m_areaInstance && !entry.m_transient)
+			{
+				entry.m_removed = true;
+				m_hasRemoved = true;
+			}
+		}
+	}
+
+	bool IsAreaRegistered(IA_AreaInstance inst)
+	{
+		foreach (IA_ScheduledTaskEntry entry : m_entries)
+		{
+			if (entry.m_areaInstance == inst && !entry.m_removed)
+				return true;
+		}
+		return false;
+	}
+
+	int GetDeferredLastFrame()
+	{
+		return m_deferredLastFrame;
+	}
+
+	int GetOverrunFrames()
+	{
+		return m_overrunFrames;
+	}
+
+	private void AddEntry(IA_AreaInstance inst, IA_ScheduledTask task, bool transient, int periodMs, int phaseMs)
+	{
+		IA_ScheduledTaskEntry entry = new IA_ScheduledTaskEntry();
+		entry.m_areaInstance = inst;
+		entry.m_task = task;
+		entry.m_transient = transient;
+		entry.m_periodMs = periodMs;
+		entry.m_nextDueMs = System.GetTickCount() + phaseMs;
+		m_entries.Insert(entry);
+	}
+
+	private void Compact()
+	{
+		for (int i = m_entries.Count() - 1; i >= 0; i--)
+		{
+			if (m_entries[i].m_removed)
+				m_entries.Remove(i);
+		}
+		m_hasRemoved = false;
+		if (m_cursor >= m_entries.Count())
+			m_cursor = 0;
+	}
+
+	//! Walks the entries from where the previous frame stopped. The first due
+	//! task always runs so nothing starves; after that a task only starts if
+	//! its last measured cost still fits in what is left of the budget.
+	private void Tick()
+	{
+		if (m_hasRemoved)
+			Compact();
+
+		int count = m_entries.Count();
+		if (count == 0)
+			return;
+
+		int frameStart = System.GetTickCount();
+		bool ranAny = false;
+		int deferred = 0;
+		int stopCursor = -1;
+
+		for (int visited = 0; visited < count; visited++)
+		{
+			int idx = (m_cursor + visited) % count;
+			IA_ScheduledTaskEntry entry = m_entries[idx];
+			if (entry.m_removed || frameStart < entry.m_nextDueMs)
+				continue;
+
+			int elapsed = System.GetTickCount() - frameStart;
+			if (ranAny && elapsed + entry.m_lastCostMs > FRAME_BUDGET_MS)
+			{
+				if (stopCursor == -1)
+					stopCursor = idx;
+				deferred++;
+				continue;
+			}
+
+			int taskStart = System.GetTickCount();
+			Dispatch(entry);
+			int taskEnd = System.GetTickCount();
+			entry.m_lastCostMs = taskEnd - taskStart;
+			ranAny = true;
+
+			entry.m_nextDueMs = entry.m_nextDueMs + entry.m_periodMs;
+			if (entry.m_nextDueMs <= taskEnd)
+				entry.m_nextDueMs = taskEnd + entry.m_periodMs;
+
+			// A task may have registered or removed entries; stop and resume next frame.
+			if (m_entries.Count() != count)
+				break;
+		}
+
+		m_deferredLastFrame = deferred;
+		if (System.GetTickCount() - frameStart > FRAME_BUDGET_MS)
+			m_overrunFrames++;
+
+		// Carry over: next frame starts with the first task we had to skip.
+		if (stopCursor != -1 && stopCursor < m_entries.Count())
+			m_cursor = stopCursor;
+		else if (m_entries.Count() > 0)
+			m_cursor = (m_cursor + 1) % m_entries.Count();
+	}
+
+	private void Dispatch(IA_ScheduledTaskEntry entry)
+	{
+		if (entry.m_task == IA_ScheduledTask.GameUpdate)
+		{
+			IA_Game game = IA_Game.Instantiate();
+			if (game)
+				game.PeriodicalGameTask();
+			return;
+		}
+
+		IA_AreaInstance inst = entry.m_areaInstance;
+		if (!inst || !inst.m_area)
+		{
+			entry.m_removed = true;
+			m_hasRemoved = true;
+			return;
+		}
+
+		if (!entry.m_transient && inst.GetAreaGroup() != IA_Game.GetActiveGroupID())
+			return;
+
+		inst.RunScheduledTask(entry.m_task);
+	}
+};
@@ -0,0 +1,258 @@
+///////////////////////////////////////////////////////////////////////
+// IA_ThreatMap - decaying danger heat around the active area group
+///////////////////////////////////////////////////////////////////////
+
+//! Coarse grid of CELL_SIZE_M cells over the active area group, built next to
+//! IA_RoadPointIndex when the group activates. IA_AiGroup writes every hostile
+//! danger event its agents perceive; area and group-manager logic read threat
+//! positions back instead of scanning every group's danger history.
+//! Each cell keeps its heat and the heat-weighted sum of event positions, both
+//! stored with their update time and decayed on demand (time constant DECAY_TAU_S),
+//! so a cell's centroid stays exact while its weight fades. Cells above MIN_HEAT
+//! are tracked in an active list; queries walk that list only. Distances are in XZ.
+class IA_ThreatMap
+{
+	static const float CELL_SIZE_M = 50.0;
+	// Past the group's own radius: covers the QRF/artillery 1600 m danger-event cutoff.
+	static const float BOUNDS_MARGIN_M = 1600.0;
+	// An event of weight 0.6 drops below MIN_HEAT after ~75 s, close to the old 60-90 s staleness cutoffs.
+	static const float DECAY_TAU_S = 30.0;
+	static const float MIN_HEAT = 0.05;
+
+	protected static ref IA_ThreatMap s_instance;
+
+	protected int m_groupNumber = -1;
+	protected float m_minX;
+	protected float m_minZ;
+	protected float m_maxX;
+	protected float m_maxZ;
+	protected int m_cellsX;
+	protected int m_cellsZ;
+
+	protected ref array<float> m_heat = {};
+	protected ref array<vector> m_weightedSum = {};
+	protected ref array<int> m_updatedMs = {};
+	protected ref array<bool> m_isActive = {};
+	protected ref array<int> m_activeCells = {};
+
+	//------------------------------------------------------------------------------------------------
+	//! Replaces the map with an empty one around `groupNumber`. Drops it if the group has no center.
+	static void Build(int groupNumber)
+	{
+		s_instance = null;
+
+		vector center = IA_AreaMarker.CalculateGroupCenterPoint(groupNumber);
+		if (center == vector.Zero)
+			return;
+
+		IA_ThreatMap threatMap = new IA_ThreatMap();
+		threatMap.m_groupNumber = groupNumber;
+		float halfSize = IA_AreaMarker.CalculateGroupRadius(groupNumber) + BOUNDS_MARGIN_M;
+		threatMap.m_minX = center[0] - halfSize;
+		threatMap.m_minZ = center[2] - halfSize;
+		threatMap.m_maxX = center[0] + halfSize;
+		threatMap.m_maxZ = center[2] + halfSize;
+		threatMap.m_cellsX = Math.Max(1, Math.Ceil((threatMap.m_maxX - threatMap.m_minX) / CELL_SIZE_M));
+		threatMap.m_cellsZ = Math.Max(1, Math.Ceil((threatMap.m_maxZ - threatMap.m_minZ) / CELL_SIZE_M));
+
+		int cellCount = threatMap.m_cellsX * threatMap.m_cellsZ;
+		threatMap.m_heat.Resize(cellCount);
+		threatMap.m_weightedSum.Resize(cellCount);
+		threatMap.m_updatedMs.Resize(cellCount);
+		threatMap.m_isActive.Resize(cellCount);
+		s_instance = threatMap;
+
+		if (IA_Log.IsOn(IA_LogCategory.Area))
+			IA_Log.Write(IA_LogCategory.Area, string.Format("Threat map for group %1: %2x%3 cells", groupNumber, threatMap.m_cellsX, threatMap.m_cellsZ));
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static void Clear()
+	{
+		s_instance = null;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Adds a danger event to the map, if there is one and it covers `position`.
+	static void RecordEvent(vector position, float weight)
+	{
+		if (!s_instance || weight <= 0)
+			return;
+		s_instance.Record(position, weight, System.GetTickCount());
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! The map if it holds the whole circle, else null. A covering map is authoritative:
+	//! no heat there means no recent danger there.
+	static IA_ThreatMap GetIfCovers(vector center, float radius)
+	{
+		if (!s_instance || !s_instance.Covers(center, radius))
+			return null;
+		return s_instance;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	bool Covers(vector center, float radius)
+	{
+		return center[0] - radius >= m_minX && center[0] + radius <= m_maxX
+			&& center[2] - radius >= m_minZ && center[2] + radius <= m_maxZ;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void Record(vector position, float weight, int nowMs)
+	{
+		int cell = CellOf(position[0], position[2]);
+		if (cell < 0)
+			return;
+
+		float decay = DecayFactor(cell, nowMs);
+		m_heat[cell] = m_heat[cell] * decay + weight;
+		m_weightedSum[cell] = m_weightedSum[cell] * decay + position * weight;
+		m_updatedMs[cell] = nowMs;
+
+		if (!m_isActive[cell])
+		{
+			m_isActive[cell] = true;
+			m_activeCells.Insert(cell);
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Heat-weighted mean position of all danger within `radius` of `center`, or vector.Zero.
+	vector GetCentroid(vector center, float radius, out float outHeat)
+	{
+		outHeat = 0;
+		int nowMs = System.GetTickCount();
+		PruneCold(nowMs);
+
+		float radiusSq = radius * radius;
+		vector sum = vector.Zero;
+		foreach (int cell : m_activeCells)
+		{
+			float heat = GetHeat(cell, nowMs);
+			vector cellPos = m_weightedSum[cell] / m_heat[cell];
+			if (vector.DistanceSqXZ(cellPos, center) > radiusSq)
+				continue;
+
+			sum += cellPos * heat;
+			outHeat += heat;
+		}
+
+		if (outHeat <= 0)
+			return vector.Zero;
+		return sum / outHeat;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Centroid of the hottest 3x3 block of cells whose center cell lies within `radius`
+	//! of `center`, or vector.Zero. Unlike GetCentroid, scattered contacts elsewhere don't
+	//! pull it off the main fight.
+	vector GetHotspot(vector center, float radius, out float outHeat)
+	{
+		outHeat = 0;
+		int nowMs = System.GetTickCount();
+		PruneCold(nowMs);
+
+		float radiusSq = radius * radius;
+		vector best = vector.Zero;
+		foreach (int cell : m_activeCells)
+		{
+			vector cellPos = m_weightedSum[cell] / m_heat[cell];
+			if (vector.DistanceSqXZ(cellPos, center) > radiusSq)
+				continue;
+
+			float blockHeat;
+			vector blockPos = BlockCentroid(cell, nowMs, blockHeat);
+			if (blockHeat > outHeat)
+			{
+				outHeat = blockHeat;
+				best = blockPos;
+			}
+		}
+		return best;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	int GetGroupNumber()
+	{
+		return m_groupNumber;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	int GetActiveCellCount()
+	{
+		return m_activeCells.Count();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected vector BlockCentroid(int cell, int nowMs, out float outHeat)
+	{
+		outHeat = 0;
+		int cx = cell % m_cellsX;
+		int cz = cell / m_cellsX;
+		int x0 = Math.ClampInt(cx - 1, 0, m_cellsX - 1);
+		int x1 = Math.ClampInt(cx + 1, 0, m_cellsX - 1);
+		int z0 = Math.ClampInt(cz - 1, 0, m_cellsZ - 1);
+		int z1 = Math.ClampInt(cz + 1, 0, m_cellsZ - 1);
+		vector sum = vector.Zero;
+		for (int z = z0; z <= z1; z++)
+		{
+			for (int x = x0; x <= x1; x++)
+			{
+				int neighbour = z * m_cellsX + x;
+				if (!m_isActive[neighbour])
+					continue;
+
+				float heat = GetHeat(neighbour, nowMs);
+				sum += m_weightedSum[neighbour] / m_heat[neighbour] * heat;
+				outHeat += heat;
+			}
+		}
+
+		if (outHeat <= 0)
+			return vector.Zero;
+		return sum / outHeat;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Drops cells that have cooled below MIN_HEAT from the active list.
+	protected void PruneCold(int nowMs)
+	{
+		for (int i = m_activeCells.Count() - 1; i >= 0; i--)
+		{
+			int cell = m_activeCells[i];
+			if (GetHeat(cell, nowMs) >= MIN_HEAT)
+				continue;
+
+			m_heat[cell] = 0;
+			m_weightedSum[cell] = vector.Zero;
+			m_isActive[cell] = false;
+			m_activeCells.Remove(i);
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected float GetHeat(int cell, int nowMs)
+	{
+		return m_heat[cell] * DecayFactor(cell, nowMs);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected float DecayFactor(int cell, int nowMs)
+	{
+		if (m_heat[cell] <= 0)
+			return 0;
+		float ageS = (nowMs - m_updatedMs[cell]) / 1000.0;
+		return Math.Pow(Math.E, -ageS / DECAY_TAU_S);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected int CellOf(float x, float z)
+	{
+		if (x < m_minX || x > m_maxX || z < m_minZ || z > m_maxZ)
+			return -1;
+		int cx = Math.ClampInt(Math.Floor((x - m_minX) / CELL_SIZE_M), 0, m_cellsX - 1);
+		int cz = Math.ClampInt(Math.Floor((z - m_minZ) / CELL_SIZE_M), 0, m_cellsZ - 1);
+		return cz * m_cellsX + cx;
+	}
+};
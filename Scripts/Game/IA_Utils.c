@@ -361,107 +361,200 @@ EntitySpawnParams IA_CreateSurfaceAdjustedSpawnParams(vector origin)
 
 
 
+// ----------------------------------------------------------------------------------------------
+//  Open-addressing slot table shared by the IA_Dict* maps below.
+//  Entries live in dense parallel arrays (keys / hashes / values) so GetPair(i) iterates
+//  without allocating; this table maps hash -> dense index with linear probing.
+// ----------------------------------------------------------------------------------------------
+class IA_HashSlots
+{
+	static const int EMPTY = -1;
+	static const int TOMBSTONE = -2;
+	static const int MIN_CAPACITY = 16;
+
+	protected ref array<int> m_Slots = {};
+	protected int m_Mask;
+	protected int m_Used; // live entries + tombstones
+
+	void IA_HashSlots()
+	{
+		Reset(MIN_CAPACITY);
+	}
+
+	void Reset(int capacity)
+	{
+		int size = MIN_CAPACITY;
+		while (size < capacity)
+			size = size * 2;
+
+		m_Slots.Resize(size);
+		for (int i = 0; i < size; i++)
+			m_Slots[i] = EMPTY;
+		m_Mask = size - 1;
+		m_Used = 0;
+	}
+
+	int Home(int hash)
+	{
+		return hash & m_Mask;
+	}
+
+	int Next(int slot)
+	{
+		return (slot + 1) & m_Mask;
+	}
+
+	int Get(int slot)
+	{
+		return m_Slots[slot];
+	}
+
+	// First empty or tombstone slot on the probe path for this hash
+	int FindFree(int hash)
+	{
+		int slot = Home(hash);
+		while (m_Slots[slot] >= 0)
+			slot = Next(slot);
+		return slot;
+	}
+
+	void Occupy(int slot, int denseIndex)
+	{
+		if (m_Slots[slot] == EMPTY)
+			m_Used++;
+		m_Slots[slot] = denseIndex;
+	}
+
+	void Vacate(int slot)
+	{
+		m_Slots[slot] = TOMBSTONE;
+	}
+
+	// Keep load (including tombstones) at or below 75% so probes always hit an empty slot
+	bool NeedsRebuild()
+	{
+		return (m_Used + 1) * 4 > m_Slots.Count() * 3;
+	}
+
+	void Rebuild(array<int> hashes, int count)
+	{
+		Reset(count * 2);
+		for (int i = 0; i < count; i++)
+			Occupy(FindFree(hashes[i]), i);
+	}
+}
+
+int IA_HashInt(int key)
+{
+	// Multiplicative hash by 2654435761 (0x9E3779B1 as a signed int). Home() keeps the low
+	// bits, and an odd multiplier maps those one-to-one, so sequential ids (RplIds) still
+	// land in distinct home slots
+	return key * -1640531535;
+}
+
 // ----------------------------------------------------------------------------------------------
 //  Basic dictionary: string -> int
 // ----------------------------------------------------------------------------------------------
-const int IA_DICT_STRING_INT_MAX = 32;
 class IA_DictStringInt
 {
-	private string  m_Keys[IA_DICT_STRING_INT_MAX];
-	private int     m_Values[IA_DICT_STRING_INT_MAX];
-	private int     m_Count;
+	private ref array<string> m_Keys = {};
+	private ref array<int>    m_Hashes = {};
+	private ref array<int>    m_Values = {};
+	private ref IA_HashSlots  m_Slots = new IA_HashSlots();
 
-	void IA_DictStringInt()
+	private int FindSlot(string key, int hash)
 	{
-		m_Count = 0;
-		for (int i = 0; i < IA_DICT_STRING_INT_MAX; i++)
+		int slot = m_Slots.Home(hash);
+		while (true)
 		{
-			m_Keys[i]   = "";
-			m_Values[i] = 0;
+			int dense = m_Slots.Get(slot);
+			if (dense == IA_HashSlots.EMPTY)
+				return -1;
+			if (dense >= 0 && m_Hashes[dense] == hash && m_Keys[dense] == key)
+				return slot;
+			slot = m_Slots.Next(slot);
 		}
+		return -1;
 	}
 
 	// Return true if key exists
 	bool Contains(string key)
 	{
-		for (int i = 0; i < m_Count; i++)
-			if (m_Keys[i] == key) return true;
-		return false;
+		return FindSlot(key, key.Hash()) != -1;
 	}
 
 	// Return value for key (or 0 if not found)
 	int Get(string key)
 	{
-		for (int i = 0; i < m_Count; i++)
-			if (m_Keys[i] == key) return m_Values[i];
-		return 0;
+		int slot = FindSlot(key, key.Hash());
+		if (slot == -1)
+			return 0;
+		return m_Values[m_Slots.Get(slot)];
 	}
 
 	// Insert or update key with given value
 	void Set(string key, int value)
 	{
-		// If key already exists, update
-		for (int i = 0; i < m_Count; i++)
+		int hash = key.Hash();
+		int slot = FindSlot(key, hash);
+		if (slot != -1)
 		{
-			if (m_Keys[i] == key)
-			{
-				m_Values[i] = value;
-				return;
-			}
+			m_Values[m_Slots.Get(slot)] = value;
+			return;
 		}
 
-		// Otherwise add a new entry if there's space
-		if (m_Count < IA_DICT_STRING_INT_MAX)
-		{
-			m_Keys[m_Count]   = key;
-			m_Values[m_Count] = value;
-			m_Count++;
-		}
+		if (m_Slots.NeedsRebuild())
+			m_Slots.Rebuild(m_Hashes, m_Keys.Count());
+
+		m_Slots.Occupy(m_Slots.FindFree(hash), m_Keys.Count());
+		m_Keys.Insert(key);
+		m_Hashes.Insert(hash);
+		m_Values.Insert(value);
 	}
 
-	// Remove entry by key
+	// Remove entry by key (last entry moves into the freed position)
 	void Remove(string key)
 	{
-		for (int i = 0; i < m_Count; i++)
+		int slot = FindSlot(key, key.Hash());
+		if (slot == -1)
+			return;
+
+		int dense = m_Slots.Get(slot);
+		m_Slots.Vacate(slot);
+
+		int last = m_Keys.Count() - 1;
+		if (dense != last)
 		{
-			if (m_Keys[i] == key)
-			{
-				// shift everything down
-				for (int j = i; j < m_Count - 1; j++)
-				{
-					m_Keys[j]   = m_Keys[j + 1];
-					m_Values[j] = m_Values[j + 1];
-				}
-				// Clear the last
-				m_Keys[m_Count - 1]   = "";
-				m_Values[m_Count - 1] = 0;
-				m_Count--;
-				return;
-			}
+			int movedSlot = FindSlot(m_Keys[last], m_Hashes[last]);
+			m_Keys[dense]   = m_Keys[last];
+			m_Hashes[dense] = m_Hashes[last];
+			m_Values[dense] = m_Values[last];
+			m_Slots.Occupy(movedSlot, dense);
 		}
+		m_Keys.Remove(last);
+		m_Hashes.Remove(last);
+		m_Values.Remove(last);
 	}
 
 	// Clear entire dictionary
 	void Clear()
 	{
-		for (int i = 0; i < m_Count; i++)
-		{
-			m_Keys[i]   = "";
-			m_Values[i] = 0;
-		}
-		m_Count = 0;
+		m_Keys.Clear();
+		m_Hashes.Clear();
+		m_Values.Clear();
+		m_Slots.Reset(IA_HashSlots.MIN_CAPACITY);
 	}
 
 	// Get number of valid key-value pairs
 	int GetCount()
 	{
-		return m_Count;
+		return m_Keys.Count();
 	}
 
 	// Access the i-th entry (for loops)
 	void GetPair(int index, out string key, out int value)
 	{
-		if (index < 0 || index >= m_Count)
+		if (index < 0 || index >= m_Keys.Count())
 		{
 			key   = "";
 			value = 0;
@@ -476,177 +569,205 @@ class IA_DictStringInt
 //  For storing (RplId hash -> string). 
 //  We cannot store SCR_ChimeraCharacter references without 'ref', so we store an int hash.
 // ----------------------------------------------------------------------------------------------
-const int IA_DICT_INT_STRING_MAX = 64;
 class IA_DictIntString
 {
-	private int     m_Keys[IA_DICT_INT_STRING_MAX];
-	private string  m_Values[IA_DICT_INT_STRING_MAX];
-	private int     m_Count;
+	private ref array<int>    m_Keys = {};
+	private ref array<int>    m_Hashes = {};
+	private ref array<string> m_Values = {};
+	private ref IA_HashSlots  m_Slots = new IA_HashSlots();
 
-	void IA_DictIntString()
+	private int FindSlot(int key, int hash)
 	{
-		m_Count = 0;
-		for (int i = 0; i < IA_DICT_INT_STRING_MAX; i++)
+		int slot = m_Slots.Home(hash);
+		while (true)
 		{
-			m_Keys[i]   = 0;
-			m_Values[i] = "";
+			int dense = m_Slots.Get(slot);
+			if (dense == IA_HashSlots.EMPTY)
+				return -1;
+			if (dense >= 0 && m_Keys[dense] == key)
+				return slot;
+			slot = m_Slots.Next(slot);
 		}
+		return -1;
 	}
 
 	bool Contains(int key)
 	{
-		for (int i = 0; i < m_Count; i++)
-			if (m_Keys[i] == key) return true;
-		return false;
+		return FindSlot(key, IA_HashInt(key)) != -1;
 	}
 
 	string Get(int key)
 	{
-		for (int i = 0; i < m_Count; i++)
-			if (m_Keys[i] == key) return m_Values[i];
-		return "";
+		int slot = FindSlot(key, IA_HashInt(key));
+		if (slot == -1)
+			return "";
+		return m_Values[m_Slots.Get(slot)];
 	}
 
 	void Set(int key, string value)
 	{
-		for (int i = 0; i < m_Count; i++)
+		int hash = IA_HashInt(key);
+		int slot = FindSlot(key, hash);
+		if (slot != -1)
 		{
-			if (m_Keys[i] == key)
-			{
-				m_Values[i] = value;
-				return;
-			}
-		}
-		// Insert new if there's space
-		if (m_Count < IA_DICT_INT_STRING_MAX)
-		{
-			m_Keys[m_Count]   = key;
-			m_Values[m_Count] = value;
-			m_Count++;
+			m_Values[m_Slots.Get(slot)] = value;
+			return;
 		}
+
+		if (m_Slots.NeedsRebuild())
+			m_Slots.Rebuild(m_Hashes, m_Keys.Count());
+
+		m_Slots.Occupy(m_Slots.FindFree(hash), m_Keys.Count());
+		m_Keys.Insert(key);
+		m_Hashes.Insert(hash);
+		m_Values.Insert(value);
 	}
 
 	void Remove(int key)
 	{
-		for (int i = 0; i < m_Count; i++)
+		int slot = FindSlot(key, IA_HashInt(key));
+		if (slot == -1)
+			return;
+
+		int dense = m_Slots.Get(slot);
+		m_Slots.Vacate(slot);
+
+		int last = m_Keys.Count() - 1;
+		if (dense != last)
 		{
-			if (m_Keys[i] == key)
-			{
-				for (int j = i; j < m_Count - 1; j++)
-				{
-					m_Keys[j]   = m_Keys[j + 1];
-					m_Values[j] = m_Values[j + 1];
-				}
-				m_Keys[m_Count - 1]   = 0;
-				m_Values[m_Count - 1] = "";
-				m_Count--;
-				return;
-			}
+			int movedSlot = FindSlot(m_Keys[last], m_Hashes[last]);
+			m_Keys[dense]   = m_Keys[last];
+			m_Hashes[dense] = m_Hashes[last];
+			m_Values[dense] = m_Values[last];
+			m_Slots.Occupy(movedSlot, dense);
 		}
+		m_Keys.Remove(last);
+		m_Hashes.Remove(last);
+		m_Values.Remove(last);
 	}
 
 	void Clear()
 	{
-		for (int i = 0; i < m_Count; i++)
+		m_Keys.Clear();
+		m_Hashes.Clear();
+		m_Values.Clear();
+		m_Slots.Reset(IA_HashSlots.MIN_CAPACITY);
+	}
+
+	int GetCount()
+	{
+		return m_Keys.Count();
+	}
+
+	void GetPair(int index, out int key, out string value)
+	{
+		if (index < 0 || index >= m_Keys.Count())
 		{
-			m_Keys[i]   = 0;
-			m_Values[i] = "";
+			key   = 0;
+			value = "";
+			return;
 		}
-		m_Count = 0;
+		key   = m_Keys[index];
+		value = m_Values[index];
 	}
 }
 
 // ----------------------------------------------------------------------------------------------
 //  For storing (string -> float)
 // ----------------------------------------------------------------------------------------------
-const int IA_DICT_STRING_FLOAT_MAX = 32;
 class IA_DictStringFloat
 {
-	private string  m_Keys[IA_DICT_STRING_FLOAT_MAX];
-	private float   m_Values[IA_DICT_STRING_FLOAT_MAX];
-	private int     m_Count;
+	private ref array<string> m_Keys = {};
+	private ref array<int>    m_Hashes = {};
+	private ref array<float>  m_Values = {};
+	private ref IA_HashSlots  m_Slots = new IA_HashSlots();
 
-	void IA_DictStringFloat()
+	private int FindSlot(string key, int hash)
 	{
-		m_Count = 0;
-		for (int i = 0; i < IA_DICT_STRING_FLOAT_MAX; i++)
+		int slot = m_Slots.Home(hash);
+		while (true)
 		{
-			m_Keys[i]   = "";
-			m_Values[i] = 0.0;
+			int dense = m_Slots.Get(slot);
+			if (dense == IA_HashSlots.EMPTY)
+				return -1;
+			if (dense >= 0 && m_Hashes[dense] == hash && m_Keys[dense] == key)
+				return slot;
+			slot = m_Slots.Next(slot);
 		}
+		return -1;
 	}
 
 	bool Contains(string key)
 	{
-		for (int i = 0; i < m_Count; i++)
-			if (m_Keys[i] == key) return true;
-		return false;
+		return FindSlot(key, key.Hash()) != -1;
 	}
 
 	float Get(string key)
 	{
-		for (int i = 0; i < m_Count; i++)
-			if (m_Keys[i] == key) return m_Values[i];
-		return 0.0;
+		int slot = FindSlot(key, key.Hash());
+		if (slot == -1)
+			return 0.0;
+		return m_Values[m_Slots.Get(slot)];
 	}
 
 	void Set(string key, float value)
 	{
-		// If key already exists, update
-		for (int i = 0; i < m_Count; i++)
+		int hash = key.Hash();
+		int slot = FindSlot(key, hash);
+		if (slot != -1)
 		{
-			if (m_Keys[i] == key)
-			{
-				m_Values[i] = value;
-				return;
-			}
-		}
-		// Otherwise add new if there's space
-		if (m_Count < IA_DICT_STRING_FLOAT_MAX)
-		{
-			m_Keys[m_Count]   = key;
-			m_Values[m_Count] = value;
-			m_Count++;
+			m_Values[m_Slots.Get(slot)] = value;
+			return;
 		}
+
+		if (m_Slots.NeedsRebuild())
+			m_Slots.Rebuild(m_Hashes, m_Keys.Count());
+
+		m_Slots.Occupy(m_Slots.FindFree(hash), m_Keys.Count());
+		m_Keys.Insert(key);
+		m_Hashes.Insert(hash);
+		m_Values.Insert(value);
 	}
 
 	void Remove(string key)
 	{
-		for (int i = 0; i < m_Count; i++)
+		int slot = FindSlot(key, key.Hash());
+		if (slot == -1)
+			return;
+
+		int dense = m_Slots.Get(slot);
+		m_Slots.Vacate(slot);
+
+		int last = m_Keys.Count() - 1;
+		if (dense != last)
 		{
-			if (m_Keys[i] == key)
-			{
-				for (int j = i; j < m_Count - 1; j++)
-				{
-					m_Keys[j]   = m_Keys[j + 1];
-					m_Values[j] = m_Values[j + 1];
-				}
-				m_Keys[m_Count - 1]   = "";
-				m_Values[m_Count - 1] = 0.0;
-				m_Count--;
-				return;
-			}
+			int movedSlot = FindSlot(m_Keys[last], m_Hashes[last]);
+			m_Keys[dense]   = m_Keys[last];
+			m_Hashes[dense] = m_Hashes[last];
+			m_Values[dense] = m_Values[last];
+			m_Slots.Occupy(movedSlot, dense);
 		}
+		m_Keys.Remove(last);
+		m_Hashes.Remove(last);
+		m_Values.Remove(last);
 	}
 
 	void Clear()
 	{
-		for (int i = 0; i < m_Count; i++)
-		{
-			m_Keys[i]   = "";
-			m_Values[i] = 0.0;
-		}
-		m_Count = 0;
+		m_Keys.Clear();
+		m_Hashes.Clear();
+		m_Values.Clear();
+		m_Slots.Reset(IA_HashSlots.MIN_CAPACITY);
 	}
 
 	int GetCount()
 	{
-		return m_Count;
+		return m_Keys.Count();
 	}
 
 	void GetPair(int index, out string key, out float value)
 	{
-		if (index < 0 || index >= m_Count)
+		if (index < 0 || index >= m_Keys.Count())
 		{
 			key   = "";
 			value = 0.0;
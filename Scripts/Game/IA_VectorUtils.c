@@ -1,32 +1,165 @@
-class IA_VectorUtils 
+class IA_VectorUtils
 {
-    // Sorts an array of vectors in place based on their x-component using Bubble Sort
-    static void SortVectorsByX(inout array<vector> positions)
+    static const int GEOMETRIC_MEDIAN_ITERATIONS = 8;
+    static const float GEOMETRIC_MEDIAN_EPSILON_M = 0.5;
+
+    // Quickselect (nth_element) on one axis (0 = x, 1 = y, 2 = z): reorders positions in place so
+    // that index k holds the element a full sort would put there, and returns it. O(n) on average.
+    static vector NthElement(notnull array<vector> positions, int k, int axis)
     {
-        int n = positions.Count();
-        if (n <= 1)
-            return; // Already sorted or empty
+        int lo = 0;
+        int hi = positions.Count() - 1;
+        if (k < lo || k > hi)
+            return vector.Zero;
 
-        bool swapped;
-        vector temp;
-        for (int i = 0; i < n - 1; i++)
+        while (lo < hi)
         {
-            swapped = false;
-            for (int j = 0; j < n - i - 1; j++)
+            float pivot = MedianOfThree(positions[lo][axis], positions[(lo + hi) / 2][axis], positions[hi][axis]);
+            int i = lo;
+            int j = hi;
+            while (i <= j)
             {
-                if (positions[j][0] > positions[j + 1][0])
+                while (positions[i][axis] < pivot)
+                    i++;
+                while (positions[j][axis] > pivot)
+                    j--;
+                if (i <= j)
                 {
-                    // Swap elements
-                    temp = positions[j];
-                    positions[j] = positions[j + 1];
-                    positions[j + 1] = temp;
-                    swapped = true;
+                    vector temp = positions[i];
+                    positions[i] = positions[j];
+                    positions[j] = temp;
+                    i++;
+                    j--;
                 }
             }
 
-            // If no two elements were swapped by inner loop, then break
-            if (!swapped)
+            if (k <= j)
+                hi = j;
+            else if (k >= i)
+                lo = i;
+            else
+                break;
+        }
+        return positions[k];
+    }
+
+    // Coordinate-wise median (upper median for even counts). Reorders positions.
+    static vector CoordinateMedian(notnull array<vector> positions)
+    {
+        int count = positions.Count();
+        if (count == 0)
+            return vector.Zero;
+
+        int k = count / 2;
+        float x = NthElement(positions, k, 0)[0];
+        float y = NthElement(positions, k, 1)[1];
+        float z = NthElement(positions, k, 2)[2];
+        return Vector(x, y, z);
+    }
+
+    // Geometric median in XZ (Weiszfeld iterations seeded from the coordinate-wise median):
+    // the point with the least summed ground distance to all positions. Y is the coordinate
+    // median. Reorders positions.
+    static vector GeometricMedianXZ(notnull array<vector> positions)
+    {
+        vector estimate = CoordinateMedian(positions);
+        if (positions.Count() < 3)
+            return estimate;
+
+        for (int iteration = 0; iteration < GEOMETRIC_MEDIAN_ITERATIONS; iteration++)
+        {
+            float sumX = 0;
+            float sumZ = 0;
+            float sumW = 0;
+            foreach (vector pos : positions)
+            {
+                float dist = vector.DistanceXZ(pos, estimate);
+                // Points on the estimate would divide by zero; leaving them out keeps it stable.
+                if (dist < 0.01)
+                    continue;
+                float w = 1.0 / dist;
+                sumX += pos[0] * w;
+                sumZ += pos[2] * w;
+                sumW += w;
+            }
+            if (sumW <= 0)
+                break;
+
+            vector next = Vector(sumX / sumW, estimate[1], sumZ / sumW);
+            float moved = vector.DistanceXZ(next, estimate);
+            estimate = next;
+            if (moved < GEOMETRIC_MEDIAN_EPSILON_M)
                 break;
         }
+        return estimate;
+    }
+
+    // Mean of positions weighted by the matching entry of weights; vector.Zero if the weights sum to 0.
+    static vector WeightedCentroid(notnull array<vector> positions, notnull array<float> weights)
+    {
+        vector sum = vector.Zero;
+        float weightSum = 0;
+        int count = Math.Min(positions.Count(), weights.Count());
+        for (int i = 0; i < count; i++)
+        {
+            if (weights[i] <= 0)
+                continue;
+            sum += positions[i] * weights[i];
+            weightSum += weights[i];
+        }
+        if (weightSum <= 0)
+            return vector.Zero;
+        return sum / weightSum;
+    }
+
+    protected static float MedianOfThree(float a, float b, float c)
+    {
+        if (a > b)
+        {
+            float t = a;
+            a = b;
+            b = t;
+        }
+        if (b > c)
+            b = c;
+        return Math.Max(a, b);
+    }
+}
+
+// Uniform sample of at most `capacity` positions from a stream of any length (reservoir
+// sampling), so median work stays bounded when many groups report many events.
+class IA_VectorReservoir
+{
+    protected ref array<vector> m_samples = {};
+    protected int m_capacity;
+    protected int m_seen;
+
+    void IA_VectorReservoir(int capacity)
+    {
+        m_capacity = Math.Max(capacity, 1);
+    }
+
+    void Offer(vector pos)
+    {
+        m_seen++;
+        if (m_samples.Count() < m_capacity)
+        {
+            m_samples.Insert(pos);
+            return;
+        }
+
+        int slot = Math.RandomInt(0, m_seen);
+        if (slot < m_capacity)
+            m_samples[slot] = pos;
+    }
+
+    array<vector> GetSamples()
+    {
+        return m_samples;
+    }
+
+    int GetSeen()
+    {
+        return m_seen;
     }
-} 
\ No newline at end of file
+}
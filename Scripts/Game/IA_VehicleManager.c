@@ -11,27 +11,21 @@ class IA_VehicleManagerClass: GenericEntityClass {};
 
 class IA_VehicleManager: GenericEntity
 {
-    static private ref array<IEntity> m_vehicles = {};
+    // Every vehicle the manager spawned, indexed by position, area group and class
+    static private ref IA_VehicleRegistry m_registry = new IA_VehicleRegistry();
     static private IA_VehicleManager m_instance;
     static private const float DEFAULT_INITIAL_ROAD_SEARCH_RADIUS = 30.0;
     
-    // Group-specific vehicles
-    static private ref array<ref array<IEntity>> m_groupVehicles = {};
     static private int m_currentActiveGroup = -1;
     static private int m_previousActiveGroup = -1; // Add tracking for previous active group
     
     // Vehicle reservation system
     static private ref map<IEntity, IA_AiGroup> m_vehicleReservations = new map<IEntity, IA_AiGroup>(); // vehicle -> group that reserved it
+    static private ref map<IA_AiGroup, ref array<IEntity>> m_groupReservations = new map<IA_AiGroup, ref array<IEntity>>(); // group -> vehicles it reserved
     
     void IA_VehicleManager(IEntitySource src, IEntity parent)
     {
         m_instance = this;
-        
-        // Initialize vehicle groups array (create empty arrays for each potential group)
-        for (int i = 0; i < 10; i++)  // Assuming a max of 10 groups
-        {
-            m_groupVehicles.Insert(new array<IEntity>());
-        }
     }
     
     static IA_VehicleManager Instance()
@@ -44,10 +38,7 @@ class IA_VehicleManager: GenericEntity
         // Print(("[VEHICLE_DEBUG] IA_VehicleManager.Reset called", LogLevel.NORMAL);
         
         // Clear all tracked vehicles
-        m_vehicles.Clear();
-        
-        // Clear vehicle groups
-        m_groupVehicles.Clear();
+        m_registry.Clear();
         
         // Reset active group
         m_currentActiveGroup = -1;
@@ -74,17 +65,6 @@ class IA_VehicleManager: GenericEntity
         // // Print( debug info about the group change
         // Print(("[VEHICLE_DEBUG] Changing active group from " + m_currentActiveGroup + " to " + groupNumber, LogLevel.NORMAL);
         
-        // Ensure we have enough slots in the array
-        if (m_groupVehicles.Count() <= groupNumber)
-        {
-            int originalSize = m_groupVehicles.Count();
-            for (int i = originalSize; i <= groupNumber; i++)
-            {
-                m_groupVehicles.Insert(new array<IEntity>());
-            }
-            // Print(("[VEHICLE_DEBUG] Expanded group vehicles array from " + originalSize + " to " + m_groupVehicles.Count() + " slots", LogLevel.NORMAL);
-        }
-        
         // Set the active group
         m_currentActiveGroup = groupNumber;
         
@@ -200,7 +180,7 @@ class IA_VehicleManager: GenericEntity
         
         // Load resource and spawn
        //// Print(("[DEBUG_VEHICLE_SPAWN] SpawnRandomVehicle: Loading resource " + resourceName, LogLevel.NORMAL);
-        Resource resource = Resource.Load(resourceName);
+        Resource resource = IA_PrefabCache.Load(resourceName);
         if (!resource)
         {
            //// Print(("[DEBUG_VEHICLE_SPAWN] SpawnRandomVehicle: Failed to load resource: " + resourceName, LogLevel.ERROR);
@@ -225,15 +205,8 @@ class IA_VehicleManager: GenericEntity
         if (vehicle)
         {
            //// Print(("[DEBUG_VEHICLE_SPAWN] SpawnRandomVehicle: Successfully spawned vehicle at " + vehicle.GetOrigin().ToString(), LogLevel.NORMAL);
-            // Add to main vehicles array
-            m_vehicles.Insert(entity);
-            
-            // Add to group-specific array if active group is valid
-            if (m_currentActiveGroup >= 0 && m_currentActiveGroup < m_groupVehicles.Count())
-            {
-                m_groupVehicles[m_currentActiveGroup].Insert(entity);
-               //// Print(("[DEBUG_VEHICLE_SPAWN] SpawnRandomVehicle: Added to group " + m_currentActiveGroup, LogLevel.NORMAL);
-            }
+            // Track it under the active group
+            m_registry.Add(vehicle, m_currentActiveGroup);
         }
         else
         {
@@ -262,7 +235,7 @@ class IA_VehicleManager: GenericEntity
             return null;
         }
         
-        Resource resource = Resource.Load(resourceName);
+        Resource resource = IA_PrefabCache.Load(resourceName);
         if (!resource)
         {
            //// Print(("[IA_VehicleManager.SpawnVehicle] No such resource: " + resourceName, LogLevel.ERROR);
@@ -276,14 +249,8 @@ class IA_VehicleManager: GenericEntity
         if (vehicle)
         {
             //// Print(("[DEBUG] IA_VehicleManager.SpawnVehicle: Successfully spawned vehicle at " + position.ToString(), LogLevel.NORMAL);
-            // Add to main vehicles array
-            m_vehicles.Insert(entity);
-            
-            // Add to group-specific array if active group is valid
-            if (m_currentActiveGroup >= 0 && m_currentActiveGroup < m_groupVehicles.Count())
-            {
-                m_groupVehicles[m_currentActiveGroup].Insert(entity);
-            }
+            // Track it under the active group
+            m_registry.Add(vehicle, m_currentActiveGroup);
             
             // Automatically create AI units for the vehicle
             if (faction != IA_Faction.CIV && IA_Game.CurrentAreaInstance) // Only for military vehicles
@@ -334,24 +301,7 @@ class IA_VehicleManager: GenericEntity
     
     static Vehicle GetClosestVehicle(vector position, float maxDistance = 100)
     {
-        Vehicle closest = null;
-        float minDist = maxDistance;
-        
-        foreach (IEntity entity : m_vehicles)
-        {
-            Vehicle vehicle = Vehicle.Cast(entity);
-            if (!vehicle)
-                continue;
-                
-            float dist = vector.Distance(position, vehicle.GetOrigin());
-            if (dist < minDist)
-            {
-                minDist = dist;
-                closest = vehicle;
-            }
-        }
-        
-        return closest;
+        return m_registry.FindNearest(position, maxDistance, -1, false);
     }
     
     static bool IsVehicleOccupied(Vehicle vehicle)
@@ -385,9 +335,7 @@ class IA_VehicleManager: GenericEntity
         if (!vehicle)
             return;
             
-        int idx = m_vehicles.Find(vehicle);
-        if (idx != -1)
-            m_vehicles.Remove(idx);
+        m_registry.Remove(vehicle);
             
         IA_Game.AddEntityToGc(vehicle);
     }
@@ -445,43 +393,16 @@ class IA_VehicleManager: GenericEntity
     static array<Vehicle> GetVehiclesInAreaGroup(int groupNumber)
     {
         array<Vehicle> groupVehicles = {};
-        
-        // If group index is valid
-        if (groupNumber >= 0 && groupNumber < m_groupVehicles.Count())
-        {
-            // Get vehicles from the specific group array
-            foreach (IEntity entity : m_groupVehicles[groupNumber])
-            {
-                if (!entity)
-                    continue;
-                    
-                Vehicle vehicle = Vehicle.Cast(entity);
-                if (vehicle)
-                    groupVehicles.Insert(vehicle);
-            }
-        }
-        
+        m_registry.GetVehiclesInGroup(groupNumber, groupVehicles);
         return groupVehicles;
     }
     
     // Get closest vehicle within a specific area group
     static Vehicle GetClosestVehicleInGroup(vector position, int groupNumber, float maxDistance = 100)
     {
-        Vehicle closest = null;
-        float minDist = maxDistance;
-        
-        array<Vehicle> groupVehicles = GetVehiclesInAreaGroup(groupNumber);
-        foreach (Vehicle vehicle : groupVehicles)
-        {
-            float dist = vector.Distance(position, vehicle.GetOrigin());
-            if (dist < minDist)
-            {
-                minDist = dist;
-                closest = vehicle;
-            }
-        }
-        
-        return closest;
+        if (groupNumber < 0)
+            return null;
+        return m_registry.FindNearest(position, maxDistance, groupNumber, false);
     }
     
     // Reserve a vehicle for a specific group
@@ -512,14 +433,15 @@ class IA_VehicleManager: GenericEntity
             }
         }
 
-        // Record current reservations for debugging
-        string previousMapState = "Before reservation: ";
-        foreach (IEntity veh, IA_AiGroup grp : m_vehicleReservations)
-            previousMapState += veh.ToString() + " -> " + grp.ToString() + ", ";
-        // Print(("[VEHICLE_DEBUG] " + previousMapState, LogLevel.NORMAL);
-
         // Make the reservation
         m_vehicleReservations[vehicle] = reservingGroup;
+        array<IEntity> reserved = m_groupReservations.Get(reservingGroup);
+        if (!reserved)
+        {
+            reserved = {};
+            m_groupReservations.Insert(reservingGroup, reserved);
+        }
+        reserved.Insert(vehicle);
         
         // Debug the new state
         // Print(("[VEHICLE_DEBUG] Vehicle reserved successfully. Total reservations: " + m_vehicleReservations.Count(), LogLevel.NORMAL);
@@ -532,14 +454,7 @@ class IA_VehicleManager: GenericEntity
         if (!vehicle)
             return false;
             
-        bool isReserved = m_vehicleReservations.Contains(vehicle);
-        if (isReserved)
-        {
-            IA_AiGroup reservedBy = m_vehicleReservations[vehicle];
-            // Print(("[VEHICLE_DEBUG] IsVehicleReserved: Vehicle " + vehicle + " is reserved by group " + reservedBy, LogLevel.NORMAL);
-        }
-        
-        return isReserved;
+        return m_vehicleReservations.Contains(vehicle);
     }
     
     // Check if a vehicle is reserved by a specific group
@@ -582,15 +497,30 @@ class IA_VehicleManager: GenericEntity
             return;
         }
             
-        // Record group before removal for debugging
         IA_AiGroup group = m_vehicleReservations[vehicle];
         
         // Remove the reservation
         m_vehicleReservations.Remove(vehicle);
+        array<IEntity> reserved = m_groupReservations.Get(group);
+        if (reserved)
+        {
+            reserved.RemoveItem(vehicle);
+            if (reserved.IsEmpty())
+                m_groupReservations.Remove(group);
+        }
         
        //Print("[VEHICLE_DEBUG] Released reservation for vehicle " + vehicle + " from group " + group + ". Remaining reservations: " + m_vehicleReservations.Count(), LogLevel.NORMAL);
     }
     
+    // Truck/APC/armour flags (IA_VehicleRegistry.CLASS_*) from the vehicle's catalog labels, cached per vehicle and prefab
+    static void GetVehicleClass(Vehicle vehicle, out bool isTruck, out bool isAPC, out bool isArmored)
+    {
+        int flags = m_registry.GetClassFlags(vehicle);
+        isTruck = (flags & IA_VehicleRegistry.CLASS_TRUCK) != 0;
+        isAPC = (flags & IA_VehicleRegistry.CLASS_APC) != 0;
+        isArmored = (flags & IA_VehicleRegistry.CLASS_ARMOR) != 0;
+    }
+    
     // Get count of units targeting a specific vehicle
     static int GetVehicleTargetCount(Vehicle vehicle)
     {
@@ -605,52 +535,15 @@ class IA_VehicleManager: GenericEntity
     // Find the closest unreserved vehicle
     static Vehicle GetClosestUnreservedVehicle(vector position, float maxDistance = 100)
     {
-        Vehicle closest = null;
-        float minDist = maxDistance;
-        
-        foreach (IEntity entity : m_vehicles)
-        {
-            Vehicle vehicle = Vehicle.Cast(entity);
-            if (!vehicle)
-                continue;
-                
-            // Skip if already reserved
-            if (IsVehicleReserved(vehicle))
-                continue;
-                
-            float dist = vector.Distance(position, vehicle.GetOrigin());
-            if (dist < minDist)
-            {
-                minDist = dist;
-                closest = vehicle;
-            }
-        }
-        
-        return closest;
+        return m_registry.FindNearest(position, maxDistance, -1, true);
     }
     
     // Find the closest unreserved vehicle in a specific area group
     static Vehicle GetClosestUnreservedVehicleInGroup(vector position, int groupNumber, float maxDistance = 100)
     {
-        Vehicle closest = null;
-        float minDist = maxDistance;
-        
-        array<Vehicle> groupVehicles = GetVehiclesInAreaGroup(groupNumber);
-        foreach (Vehicle vehicle : groupVehicles)
-        {
-            // Skip if already reserved
-            if (IsVehicleReserved(vehicle))
-                continue;
-                
-            float dist = vector.Distance(position, vehicle.GetOrigin());
-            if (dist < minDist)
-            {
-                minDist = dist;
-                closest = vehicle;
-            }
-        }
-        
-        return closest;
+        if (groupNumber < 0)
+            return null;
+        return m_registry.FindNearest(position, maxDistance, groupNumber, true);
     }
     
     // Check if a vehicle has reached its destination waypoint (within 10m)
@@ -759,6 +652,7 @@ class IA_VehicleManager: GenericEntity
     static void ClearAllReservations()
     {
         m_vehicleReservations.Clear();
+        m_groupReservations.Clear();
     }
     
     // Clear reservations for a specific group
@@ -767,20 +661,17 @@ class IA_VehicleManager: GenericEntity
         if (!group)
             return;
             
-        array<IEntity> vehiclesToClear = {};
-        
-        // Find all vehicles reserved by this group
-        foreach (IEntity vehicle, IA_AiGroup reservingGroup : m_vehicleReservations)
-        {
-            if (reservingGroup == group)
-                vehiclesToClear.Insert(vehicle);
-        }
+        array<IEntity> vehiclesToClear = m_groupReservations.Get(group);
+        if (!vehiclesToClear)
+            return;
         
         // Remove the reservations
         foreach (IEntity vehicle : vehiclesToClear)
         {
-            m_vehicleReservations.Remove(vehicle);
+            if (vehicle)
+                m_vehicleReservations.Remove(vehicle);
         }
+        m_groupReservations.Remove(group);
     }
     
     // Helper methods to spawn specific vehicle types
@@ -1217,6 +1108,16 @@ class IA_VehicleManager: GenericEntity
                 }
             }
             
+            IA_RoadPointIndex roadIndex = IA_RoadPointIndex.GetIfCovers(searchCenter, currentSearchRadius, groupNumber);
+            if (roadIndex)
+            {
+                vector indexedPoint = roadIndex.RandomInRadius(searchCenter, currentSearchRadius);
+                if (indexedPoint != vector.Zero)
+                    return indexedPoint;
+                if (attempt == maxRetries) break;
+                continue;
+            }
+
             AIWorld aiWorld = GetGame().GetAIWorld();
             SCR_AIWorld scr_aiWorld = SCR_AIWorld.Cast(aiWorld);
             if (!scr_aiWorld) {
@@ -1282,6 +1183,10 @@ class IA_VehicleManager: GenericEntity
         if (minRadius > maxRadius)
             minRadius = maxRadius;
 
+        IA_RoadPointIndex roadIndex = IA_RoadPointIndex.GetIfCovers(center, maxRadius, groupNumber);
+        if (roadIndex)
+            return roadIndex.RandomInAnnulus(center, minRadius, maxRadius);
+
         AIWorld aiWorld = GetGame().GetAIWorld();
         SCR_AIWorld scrAiWorld = SCR_AIWorld.Cast(aiWorld);
         if (!scrAiWorld)
@@ -1590,18 +1495,7 @@ class IA_VehicleManager: GenericEntity
         
         // Create a move waypoint at the destination
         ResourceName waypointResource = "{FFF9518F73279473}PrefabsEditable/Auto/AI/Waypoints/E_AIWaypoint_Move.et";
-        Resource res = Resource.Load(waypointResource);
-        if (!res)
-        {
-            //Print("[VEHICLE_DEBUG] CreateWaypointForVehicleUsingGroup - Failed to load waypoint resource", LogLevel.ERROR);
-            return;
-        }
-        
-        EntitySpawnParams params = EntitySpawnParams();
-        params.TransformMode = ETransformMode.WORLD;
-        params.Transform[3] = destination;
-        
-        IEntity waypointEntity = GetGame().SpawnEntityPrefab(res, null, params);
+        IEntity waypointEntity = IA_WaypointPool.Acquire(waypointResource, destination);
         if (!waypointEntity)
         {
             //Print("[VEHICLE_DEBUG] CreateWaypointForVehicleUsingGroup - Failed to spawn waypoint entity", LogLevel.ERROR);
@@ -1833,6 +1727,16 @@ class IA_VehicleManager: GenericEntity
                 }
             }
             
+            IA_RoadPointIndex roadIndex = IA_RoadPointIndex.GetIfCovers(searchCenter, currentSearchRadius, groupNumber);
+            if (roadIndex)
+            {
+                vector indexedPoint = roadIndex.RandomInRadius(searchCenter, currentSearchRadius);
+                if (indexedPoint != vector.Zero)
+                    return indexedPoint;
+                if (attempt == maxRetries) break;
+                continue;
+            }
+
             AIWorld aiWorld = GetGame().GetAIWorld();
             SCR_AIWorld scr_aiWorld = SCR_AIWorld.Cast(aiWorld);
             if (!scr_aiWorld) {
@@ -0,0 +1,357 @@
+///////////////////////////////////////////////////////////////////////
+// IA_VehicleRegistry - managed vehicles by position, area group and class
+///////////////////////////////////////////////////////////////////////
+
+//! One vehicle IA_VehicleManager spawned and still tracks.
+class IA_VehicleRecord
+{
+	Vehicle m_vehicle;
+	int m_areaGroup = -1;
+	int m_cellKey;
+	// Slot in IA_VehicleRegistry.m_records, kept current so removal is O(1)
+	int m_index;
+	// IA_VehicleRegistry.CLASS_* bits; -1 until first asked
+	int m_classFlags = -1;
+}
+
+//! Owns the manager's vehicle records and indexes them three ways: a sparse
+//! CELL_SIZE_M grid for nearest queries, per-area-group buckets, and an entity map.
+//! Vehicles drive, so cells are refreshed at most every REBUCKET_INTERVAL_MS (lazily,
+//! on the next query) and nearest searches widen their cell ring by MOVE_SLACK_M.
+//! Deleted vehicles are dropped on the same pass; their entity keys can no longer be
+//! looked up, so the entity map is rebuilt from the surviving records when that happens.
+class IA_VehicleRegistry
+{
+	static const float CELL_SIZE_M = 200.0;
+	static const int REBUCKET_INTERVAL_MS = 1000;
+	// How far a vehicle can drive between rebuckets.
+	static const float MOVE_SLACK_M = 50.0;
+
+	static const int CLASS_TRUCK = 1;
+	static const int CLASS_APC = 2;
+	static const int CLASS_ARMOR = 4;
+
+	// Catalog label lookups walk every faction's catalog; resolve each prefab once.
+	protected static ref map<ResourceName, int> s_classFlagsByPrefab = new map<ResourceName, int>();
+
+	protected ref array<ref IA_VehicleRecord> m_records = {};
+	protected ref map<IEntity, IA_VehicleRecord> m_byEntity = new map<IEntity, IA_VehicleRecord>();
+	protected ref map<int, ref array<IA_VehicleRecord>> m_cells = new map<int, ref array<IA_VehicleRecord>>();
+	protected ref map<int, ref array<IA_VehicleRecord>> m_groups = new map<int, ref array<IA_VehicleRecord>>();
+	protected int m_lastRebucketMs;
+
+	//------------------------------------------------------------------------------------------------
+	//! Tracks `vehicle` as belonging to `areaGroup` (-1 = none). Adding it twice does nothing.
+	void Add(Vehicle vehicle, int areaGroup)
+	{
+		if (!vehicle || m_byEntity.Contains(vehicle))
+			return;
+
+		IA_VehicleRecord record = new IA_VehicleRecord();
+		record.m_vehicle = vehicle;
+		record.m_areaGroup = areaGroup;
+		record.m_cellKey = CellKeyOf(vehicle.GetOrigin());
+		record.m_index = m_records.Count();
+		m_records.Insert(record);
+		m_byEntity.Insert(vehicle, record);
+		AddToBucket(m_cells, record.m_cellKey, record);
+		if (areaGroup >= 0)
+			AddToBucket(m_groups, areaGroup, record);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void Remove(IEntity vehicle)
+	{
+		IA_VehicleRecord record;
+		if (!vehicle || !m_byEntity.Find(vehicle, record))
+			return;
+		Unlink(record);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void Clear()
+	{
+		m_records.Clear();
+		m_byEntity.Clear();
+		m_cells.Clear();
+		m_groups.Clear();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	int GetCount()
+	{
+		return m_records.Count();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Appends the live vehicles registered to `areaGroup`.
+	void GetVehiclesInGroup(int areaGroup, notnull array<Vehicle> outVehicles)
+	{
+		array<IA_VehicleRecord> bucket = m_groups.Get(areaGroup);
+		if (!bucket)
+			return;
+
+		foreach (IA_VehicleRecord record : bucket)
+		{
+			if (record && record.m_vehicle)
+				outVehicles.Insert(record.m_vehicle);
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Closest registered vehicle strictly within maxDistance, or null. areaGroup -1 accepts any
+	//! group; unreservedOnly skips vehicles IA_VehicleManager has reserved. Walks rings of cells
+	//! outward, only as far as maxDistance (plus slack) reaches, and stops once no closer vehicle
+	//! can exist. When that disc holds more cells than are occupied, the occupied cells are
+	//! scanned once instead, so large radii cost O(occupied cells) rather than O(rings^2).
+	Vehicle FindNearest(vector position, float maxDistance, int areaGroup, bool unreservedOnly)
+	{
+		RebucketIfDue();
+
+		Vehicle best = null;
+		float bestSq = maxDistance * maxDistance;
+		float reach = maxDistance + MOVE_SLACK_M;
+		int maxRing = Math.Ceil(reach / CELL_SIZE_M);
+		int side = 2 * maxRing + 1;
+		if (side * side > m_cells.Count())
+		{
+			foreach (int key, array<IA_VehicleRecord> occupied : m_cells)
+			{
+				ScanBucket(occupied, position, areaGroup, unreservedOnly, best, bestSq);
+			}
+			return best;
+		}
+
+		int ccx = CellCoord(position[0]);
+		int ccz = CellCoord(position[2]);
+		float reachSq = reach * reach;
+		for (int ring = 0; ring <= maxRing; ring++)
+		{
+			for (int dz = -ring; dz <= ring; dz++)
+			{
+				// Inner rows only contribute their two edge cells.
+				int step = 1;
+				if (dz != -ring && dz != ring)
+					step = 2 * ring;
+
+				for (int dx = -ring; dx <= ring; dx += step)
+				{
+					// Corners of the square lie outside the search disc.
+					if (CellDistanceSq(position, ccx + dx, ccz + dz) > reachSq)
+						continue;
+
+					array<IA_VehicleRecord> bucket = m_cells.Get(CellKey(ccx + dx, ccz + dz));
+					if (bucket)
+						ScanBucket(bucket, position, areaGroup, unreservedOnly, best, bestSq);
+				}
+			}
+
+			// Vehicles bucketed in the next ring are at least this far away, less what they drove since.
+			float ringReach = ring * CELL_SIZE_M - MOVE_SLACK_M;
+			if (best && ringReach > 0 && ringReach * ringReach >= bestSq)
+				break;
+		}
+		return best;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static void ScanBucket(array<IA_VehicleRecord> bucket, vector position, int areaGroup, bool unreservedOnly, inout Vehicle best, inout float bestSq)
+	{
+		foreach (IA_VehicleRecord record : bucket)
+		{
+			if (!record || !record.m_vehicle)
+				continue;
+			if (areaGroup >= 0 && record.m_areaGroup != areaGroup)
+				continue;
+			if (unreservedOnly && IA_VehicleManager.IsVehicleReserved(record.m_vehicle))
+				continue;
+
+			float distSq = vector.DistanceSq(position, record.m_vehicle.GetOrigin());
+			if (distSq < bestSq)
+			{
+				bestSq = distSq;
+				best = record.m_vehicle;
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! CLASS_* bits of `vehicle`, cached on its record when it has one.
+	int GetClassFlags(Vehicle vehicle)
+	{
+		IA_VehicleRecord record;
+		if (!vehicle || !m_byEntity.Find(vehicle, record) || !record)
+			return ResolveClassFlags(vehicle);
+
+		if (record.m_classFlags < 0)
+			record.m_classFlags = ResolveClassFlags(vehicle);
+		return record.m_classFlags;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! CLASS_* bits from the catalog labels of the vehicle's prefab (truck, APC, armour trait).
+	static int ResolveClassFlags(Vehicle vehicle)
+	{
+		if (!vehicle)
+			return 0;
+		SCR_EditableVehicleComponent editableVehicle = SCR_EditableVehicleComponent.Cast(vehicle.FindComponent(SCR_EditableVehicleComponent));
+		if (!editableVehicle)
+			return 0;
+		ResourceName prefabPath = editableVehicle.GetPrefab();
+		if (prefabPath == string.Empty)
+			return 0;
+
+		int flags;
+		if (s_classFlagsByPrefab.Find(prefabPath, flags))
+			return flags;
+
+		SCR_FactionManager factionManager = SCR_FactionManager.Cast(GetGame().GetFactionManager());
+		if (!factionManager)
+			return 0;
+		array<Faction> allFactions = {};
+		factionManager.GetFactionsList(allFactions);
+
+		array<EEditableEntityLabel> vehicleLabels = {};
+		foreach (Faction f : allFactions)
+		{
+			SCR_Faction scrFaction = SCR_Faction.Cast(f);
+			if (!scrFaction)
+				continue;
+			SCR_EntityCatalog cat = scrFaction.GetFactionEntityCatalogOfType(EEntityCatalogType.VEHICLE, true);
+			if (!cat)
+				continue;
+			SCR_EntityCatalogEntry entry = cat.GetEntryWithPrefab(prefabPath);
+			if (entry)
+			{
+				entry.GetEditableEntityLabels(vehicleLabels);
+				break;
+			}
+		}
+
+		flags = 0;
+		foreach (EEditableEntityLabel label : vehicleLabels)
+		{
+			if (label == EEditableEntityLabel.VEHICLE_TRUCK)
+				flags |= CLASS_TRUCK;
+			if (label == EEditableEntityLabel.VEHICLE_APC)
+				flags |= CLASS_APC;
+			if (label == EEditableEntityLabel.TRAIT_ARMOR)
+				flags |= CLASS_ARMOR;
+		}
+		s_classFlagsByPrefab.Insert(prefabPath, flags);
+		return flags;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Moves records whose vehicle changed cell and drops deleted vehicles. O(vehicles), at most
+	//! once per REBUCKET_INTERVAL_MS.
+	protected void RebucketIfDue()
+	{
+		int now = System.GetTickCount();
+		if (now - m_lastRebucketMs < REBUCKET_INTERVAL_MS)
+			return;
+		m_lastRebucketMs = now;
+
+		bool droppedDeleted = false;
+		for (int i = m_records.Count() - 1; i >= 0; i--)
+		{
+			IA_VehicleRecord record = m_records[i];
+			if (!record.m_vehicle)
+			{
+				Unlink(record);
+				droppedDeleted = true;
+				continue;
+			}
+
+			int key = CellKeyOf(record.m_vehicle.GetOrigin());
+			if (key == record.m_cellKey)
+				continue;
+
+			RemoveFromBucket(m_cells, record.m_cellKey, record);
+			record.m_cellKey = key;
+			AddToBucket(m_cells, key, record);
+		}
+
+		// A vehicle deleted outside Remove() left an entry Unlink couldn't address.
+		if (droppedDeleted)
+			RebuildEntityMap();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void RebuildEntityMap()
+	{
+		m_byEntity.Clear();
+		foreach (IA_VehicleRecord record : m_records)
+		{
+			m_byEntity.Insert(record.m_vehicle, record);
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void Unlink(IA_VehicleRecord record)
+	{
+		RemoveFromBucket(m_cells, record.m_cellKey, record);
+		if (record.m_areaGroup >= 0)
+			RemoveFromBucket(m_groups, record.m_areaGroup, record);
+		if (record.m_vehicle)
+			m_byEntity.Remove(record.m_vehicle);
+
+		// array.Remove moves the last record into the freed slot.
+		int index = record.m_index;
+		m_records.Remove(index);
+		if (index < m_records.Count())
+			m_records[index].m_index = index;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static void AddToBucket(map<int, ref array<IA_VehicleRecord>> buckets, int key, IA_VehicleRecord record)
+	{
+		array<IA_VehicleRecord> bucket = buckets.Get(key);
+		if (!bucket)
+		{
+			bucket = {};
+			buckets.Insert(key, bucket);
+		}
+		bucket.Insert(record);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static void RemoveFromBucket(map<int, ref array<IA_VehicleRecord>> buckets, int key, IA_VehicleRecord record)
+	{
+		array<IA_VehicleRecord> bucket = buckets.Get(key);
+		if (!bucket)
+			return;
+		bucket.RemoveItem(record);
+		if (bucket.IsEmpty())
+			buckets.Remove(key);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static int CellCoord(float worldCoord)
+	{
+		return Math.Floor(worldCoord / CELL_SIZE_M);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static int CellKey(int cx, int cz)
+	{
+		return cx * 65536 + cz;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Squared XZ distance from `pos` to the nearest point of cell (cx, cz).
+	protected static float CellDistanceSq(vector pos, int cx, int cz)
+	{
+		float minX = cx * CELL_SIZE_M;
+		float minZ = cz * CELL_SIZE_M;
+		float dx = Math.Max(0, Math.Max(minX - pos[0], pos[0] - (minX + CELL_SIZE_M)));
+		float dz = Math.Max(0, Math.Max(minZ - pos[2], pos[2] - (minZ + CELL_SIZE_M)));
+		return dx * dx + dz * dz;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static int CellKeyOf(vector pos)
+	{
+		return CellKey(CellCoord(pos[0]), CellCoord(pos[2]));
+	}
+};
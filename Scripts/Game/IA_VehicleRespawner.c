@@ -276,7 +276,7 @@ class IA_VehicleRespawner : SCR_VehicleSpawner
 				typename.EnumToString(IA_VehicleSpawnType, m_eVehicleSpawnType)), LogLevel.DEBUG);
 		}
 		
-		Resource resource = Resource.Load(vehiclePrefabToSpawn);
+		Resource resource = IA_PrefabCache.Load(vehiclePrefabToSpawn);
 		if (!resource || !resource.IsValid())
 		{
 			Print(string.Format("IA_VehicleRespawner %1: Failed to load resource or resource is invalid: %2", m_RespawnerOwnerEntity, vehiclePrefabToSpawn), LogLevel.ERROR);
@@ -85,15 +85,22 @@ class IA_VehicleSpawnPoint: GenericEntity
             
         if (m_spawnedVehicle)
         {
-            // Check if vehicle still exists and is nearby
-            if (vector.Distance(GetOrigin(), m_spawnedVehicle.GetOrigin()) > 100)
-            {
-                OnVehicleRemoved();
-            }
-            else
-            {
-                m_isOccupied = IA_VehicleManager.IsVehicleOccupied(m_spawnedVehicle);
-            }
+            int profileStart = IA_Profiler.Begin();
+            UpdateSpawnedVehicle();
+            IA_Profiler.End("VehicleSpawnPoint.EOnFrame", profileStart);
+        }
+    }
+
+    protected void UpdateSpawnedVehicle()
+    {
+        // Check if vehicle still exists and is nearby
+        if (vector.Distance(GetOrigin(), m_spawnedVehicle.GetOrigin()) > 100)
+        {
+            OnVehicleRemoved();
+        }
+        else
+        {
+            m_isOccupied = IA_VehicleManager.IsVehicleOccupied(m_spawnedVehicle);
         }
     }
 }; 
\ No newline at end of file
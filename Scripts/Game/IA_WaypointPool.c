@@ -0,0 +1,159 @@
+///////////////////////////////////////////////////////////////////////
+// IA_WaypointPool - reused waypoint entities
+///////////////////////////////////////////////////////////////////////
+
+//! Order and drive waypoints are short-lived: a group drops its waypoints on nearly
+//! every re-task. Acquire() hands out a parked waypoint of the requested prefab
+//! (moved to the new position, completion radius and priority reset to the prefab's)
+//! and only spawns when none is parked. Release() parks a waypoint that has been
+//! removed from its group; waypoints the pool did not create are left alone.
+//! Callers must not keep a reference to a waypoint after releasing it. Waypoints that are
+//! deleted without a Release (completed, or cleaned up by the engine) leave null keys in
+//! the ownership map; those are pruned whenever it doubles in size.
+class IA_WaypointPool
+{
+	static const int MAX_FREE_PER_TYPE = 32;
+	static const int MIN_OWNED_PRUNE = 64;
+
+	protected static ref map<ResourceName, ref array<SCR_AIWaypoint>> s_mFree = new map<ResourceName, ref array<SCR_AIWaypoint>>();
+	// Prefab of every waypoint the pool spawned and has not destroyed.
+	protected static ref map<SCR_AIWaypoint, ResourceName> s_mOwned = new map<SCR_AIWaypoint, ResourceName>();
+	protected static ref map<ResourceName, float> s_mDefaultRadius = new map<ResourceName, float>();
+	protected static ref map<ResourceName, int> s_mDefaultPriority = new map<ResourceName, int>();
+	// s_mOwned size that triggers the next PruneOwned.
+	protected static int s_iPruneAt = MIN_OWNED_PRUNE;
+
+	protected static int s_iHits;
+	protected static int s_iMisses;
+	protected static int s_iReleased;
+	protected static int s_iDestroyed;
+
+	//------------------------------------------------------------------------------------------------
+	//! A waypoint of `prefab` at `position`, parked or newly spawned. Null if the prefab doesn't load.
+	static SCR_AIWaypoint Acquire(ResourceName prefab, vector position)
+	{
+		array<SCR_AIWaypoint> free = s_mFree.Get(prefab);
+		while (free && !free.IsEmpty())
+		{
+			int last = free.Count() - 1;
+			SCR_AIWaypoint parked = free[last];
+			free.Remove(last);
+			// Deleted while parked (world cleanup); try the next one.
+			if (!parked)
+				continue;
+
+			parked.SetOrigin(position);
+			Reset(parked, prefab);
+			s_iHits++;
+			return parked;
+		}
+
+		s_iMisses++;
+		Resource res = IA_PrefabCache.Load(prefab);
+		if (!res)
+			return null;
+
+		IEntity ent = GetGame().SpawnEntityPrefab(res, null, IA_CreateSimpleSpawnParams(position));
+		SCR_AIWaypoint waypoint = SCR_AIWaypoint.Cast(ent);
+		if (!waypoint)
+		{
+			if (ent)
+				IA_Game.AddEntityToGc(ent);
+			return null;
+		}
+
+		if (!s_mDefaultRadius.Contains(prefab))
+		{
+			s_mDefaultRadius.Insert(prefab, waypoint.GetCompletionRadius());
+			s_mDefaultPriority.Insert(prefab, waypoint.GetPriorityLevel());
+		}
+		if (s_mOwned.Count() >= s_iPruneAt)
+			PruneOwned();
+		s_mOwned.Insert(waypoint, prefab);
+		return waypoint;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Rebuilds s_mOwned without the entries of deleted waypoints. Runs when the map reaches
+	//! twice its size after the last prune, so the cost stays proportional to spawns.
+	protected static void PruneOwned()
+	{
+		map<SCR_AIWaypoint, ResourceName> live = new map<SCR_AIWaypoint, ResourceName>();
+		foreach (SCR_AIWaypoint owned, ResourceName ownedPrefab : s_mOwned)
+		{
+			if (owned)
+				live.Insert(owned, ownedPrefab);
+		}
+		s_mOwned = live;
+		s_iPruneAt = s_mOwned.Count() * 2;
+		if (s_iPruneAt < MIN_OWNED_PRUNE)
+			s_iPruneAt = MIN_OWNED_PRUNE;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Parks a waypoint that is no longer on any group. Safe to call twice or with foreign waypoints.
+	static void Release(AIWaypoint waypoint)
+	{
+		SCR_AIWaypoint pooled = SCR_AIWaypoint.Cast(waypoint);
+		if (!pooled)
+			return;
+
+		ResourceName prefab;
+		if (!s_mOwned.Find(pooled, prefab))
+			return;
+
+		array<SCR_AIWaypoint> free = s_mFree.Get(prefab);
+		if (!free)
+		{
+			free = {};
+			s_mFree.Insert(prefab, free);
+		}
+		if (free.Contains(pooled))
+			return;
+
+		if (free.Count() >= MAX_FREE_PER_TYPE)
+		{
+			s_mOwned.Remove(pooled);
+			IA_Game.AddEntityToGc(pooled);
+			s_iDestroyed++;
+			return;
+		}
+
+		free.Insert(pooled);
+		s_iReleased++;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Hit rate of Acquire in percent (0 before the first call).
+	static int GetHitRatePercent()
+	{
+		int total = s_iHits + s_iMisses;
+		if (total == 0)
+			return 0;
+		return Math.Round(100.0 * s_iHits / total);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! One line for the admin performance readout.
+	static string GetReportLine()
+	{
+		int parked = 0;
+		foreach (ResourceName prefab, array<SCR_AIWaypoint> free : s_mFree)
+		{
+			parked += free.Count();
+		}
+		return string.Format("WaypointPool  hit %1%  hits %2  spawned %3  released %4  destroyed %5  parked %6  owned %7",
+			GetHitRatePercent(), s_iHits, s_iMisses, s_iReleased, s_iDestroyed, parked, s_mOwned.Count());
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static void Reset(SCR_AIWaypoint waypoint, ResourceName prefab)
+	{
+		float radius;
+		if (s_mDefaultRadius.Find(prefab, radius))
+			waypoint.SetCompletionRadius(radius);
+		int priority;
+		if (s_mDefaultPriority.Find(prefab, priority))
+			waypoint.SetPriorityLevel(priority);
+	}
+};
@@ -0,0 +1,97 @@
+///////////////////////////////////////////////////////////////////////
+// IA_ZoneOccupancyTracker - event-driven player occupancy for capture zones
+///////////////////////////////////////////////////////////////////////
+
+//! Buckets every live player into the capture markers of the active area group
+//! that contain them, once per tick, from IA_PlayerSnapshot and IA_AreaMarkerIndex. Each marker
+//! keeps a player count; when a marker's count differs from the
+//! previous tick it gets IA_AreaMarker.OnOccupancyChanged. Markers nobody
+//! stands in are never touched.
+class IA_ZoneOccupancyTracker
+{
+	static const float TICK_INTERVAL_MS = 250.0;
+
+	protected static ref IA_ZoneOccupancyTracker s_instance;
+
+	protected float m_lastTickWorldTime = -1;
+	protected int m_tickId = 0;
+	protected ref array<IA_AreaMarker> m_scratch = {};
+	protected ref array<IA_AreaMarker> m_touched = {};
+	protected ref array<IA_AreaMarker> m_occupied = {};
+
+	//------------------------------------------------------------------------------------------------
+	static IA_ZoneOccupancyTracker Get()
+	{
+		if (!s_instance)
+			s_instance = new IA_ZoneOccupancyTracker();
+		return s_instance;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Called by every marker of `activeGroup` each frame; only the first call per tick does work.
+	void Update(int activeGroup)
+	{
+		BaseWorld world = GetGame().GetWorld();
+		if (!world)
+			return;
+
+		float now = world.GetWorldTime();
+		if (m_lastTickWorldTime >= 0 && now - m_lastTickWorldTime < TICK_INTERVAL_MS)
+			return;
+		m_lastTickWorldTime = now;
+
+		Rebucket(activeGroup);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void Rebucket(int activeGroup)
+	{
+		m_tickId++;
+		m_touched.Clear();
+
+		IA_PlayerSnapshot snapshot = IA_PlayerSnapshot.Get();
+		int playerCount = snapshot.GetConnectedCount();
+		for (int i = 0; i < playerCount; i++)
+		{
+			if (!snapshot.GetEntity(i))
+				continue;
+
+			m_scratch.Clear();
+			int found = IA_AreaMarkerIndex.CollectContaining(snapshot.GetPosition(i), m_scratch, true);
+			if (found == 0)
+				continue;
+
+			for (int m = 0; m < found; m++)
+			{
+				IA_AreaMarker marker = m_scratch[m];
+				// Markers of other groups don't capture; they get no events at all.
+				if (marker.m_areaGroup != activeGroup)
+					continue;
+				if (marker.m_occupancyTickId != m_tickId)
+				{
+					marker.BeginOccupancyTick(m_tickId);
+					m_touched.Insert(marker);
+				}
+				marker.AddOccupant();
+			}
+		}
+
+		// Zones occupied last tick that nobody is in now still need their leave event.
+		foreach (IA_AreaMarker previous : m_occupied)
+		{
+			if (previous && previous.m_occupancyTickId != m_tickId)
+			{
+				previous.BeginOccupancyTick(m_tickId);
+				m_touched.Insert(previous);
+			}
+		}
+
+		m_occupied.Clear();
+		foreach (IA_AreaMarker touched : m_touched)
+		{
+			touched.CommitOccupancy();
+			if (touched.GetPlayerCountInZone() > 0)
+				m_occupied.Insert(touched);
+		}
+	}
+};
@@ -216,7 +216,7 @@ class IA_RankHudPanel
 	}
 
 	//------------------------------------------------------------------------------------------------
-	protected void OnSessionUpdated(string jsonData)
+	protected void OnSessionUpdated()
 	{
 		Refresh();
 	}
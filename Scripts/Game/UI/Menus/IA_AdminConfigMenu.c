@@ -8,6 +8,7 @@ class IA_AdminConfigMenu : MUI_MenuBase
 	protected ref MUI_Panel m_PageCiv;
 	protected ref MUI_Panel m_PageArty;
 	protected ref MUI_Panel m_PageHq;
+	protected ref MUI_Panel m_PagePerf;
 
 	protected ref MUI_NumericField m_AIField;
 	protected ref MUI_NumericField m_StaticAIField;
@@ -31,6 +32,12 @@ class IA_AdminConfigMenu : MUI_MenuBase
 	protected ref MUI_NumericField m_HaloMaxField;
 	protected ref MUI_Dropdown m_FactionDrop;
 
+	protected ref array<ref MUI_Label> m_aPerfRows = {};
+	protected ref MUI_Toggle m_PerfEnableToggle;
+	protected ref MUI_Toggle m_PerfCsvToggle;
+	// Set while the toggles mirror server state, so that doesn't send a request back.
+	protected bool m_bSyncingPerf;
+
 	//------------------------------------------------------------------------------------------------
 	override void OnMenuOpen()
 	{
@@ -39,6 +46,13 @@ class IA_AdminConfigMenu : MUI_MenuBase
 			PopulateFromConfig();
 	}
 
+	//------------------------------------------------------------------------------------------------
+	override void OnMenuClose()
+	{
+		IA_Profiler.GetOnReport().Remove(OnPerfReport);
+		super.OnMenuClose();
+	}
+
 	//------------------------------------------------------------------------------------------------
 	override void OnMUIMountFailed()
 	{
@@ -68,6 +82,7 @@ class IA_AdminConfigMenu : MUI_MenuBase
 		m_Tabs.AddTab("Civilians");
 		m_Tabs.AddTab("Artillery");
 		m_Tabs.AddTab("HQ");
+		m_Tabs.AddTab("Performance");
 		m_Tabs.GetOnChanged().Insert(OnAdminTabChanged);
 
 		ref MUI_ScrollView scroll = runtime.CreateScrollView("scroll");
@@ -79,6 +94,7 @@ class IA_AdminConfigMenu : MUI_MenuBase
 		m_PageCiv = MakePage(runtime, "pageCiv");
 		m_PageArty = MakePage(runtime, "pageArty");
 		m_PageHq = MakePage(runtime, "pageHq");
+		m_PagePerf = MakePage(runtime, "pagePerf");
 
 		m_AIField = runtime.CreateNumericField("AI scale multiplier", "ai");
 		m_AIField.SetRange(0.1, 10);
@@ -187,7 +203,10 @@ class IA_AdminConfigMenu : MUI_MenuBase
 		scroll.AddChild(m_PageScaling);
 		scroll.AddChild(m_PageCiv);
 		scroll.AddChild(m_PageArty);
+		BuildPerfPage(runtime);
+
 		scroll.AddChild(m_PageHq);
+		scroll.AddChild(m_PagePerf);
 
 		ref MUI_Panel footerBtns = runtime.CreatePanel("footerBtns");
 		footerBtns.GetStyle().m_Fill = Color.FromInt(0);
@@ -242,6 +261,120 @@ class IA_AdminConfigMenu : MUI_MenuBase
 		ShowAdminPage(0);
 	}
 
+	//------------------------------------------------------------------------------------------------
+	//! Server profiler readout: one label per row, filled by OnPerfReport.
+	protected void BuildPerfPage(notnull MUI_Runtime runtime)
+	{
+		ref MUI_Label perfHint = runtime.CreateLabel("Server time per subsystem over the last 256 calls (ms). Sampling is off until enabled below.", "perfHint");
+		perfHint.SetFontSize(runtime.GetTheme().FONT_SMALL);
+		perfHint.SetMuted(true);
+		m_PagePerf.AddChild(perfHint);
+
+		m_aPerfRows.Clear();
+		for (int i = 0; i < IA_Profiler.REPORT_ROWS; i++)
+		{
+			ref MUI_Label row = runtime.CreateLabel("", "perfRow" + i.ToString());
+			row.SetFontSize(runtime.GetTheme().FONT_SMALL);
+			m_aPerfRows.Insert(row);
+			m_PagePerf.AddChild(row);
+		}
+
+		m_PerfEnableToggle = runtime.CreateToggle("Sample server timings", "perfEnable");
+		m_PerfEnableToggle.SetChecked(IA_Profiler.IsEnabled());
+		m_PerfEnableToggle.GetOnChanged().Insert(OnPerfEnableChanged);
+
+		m_PerfCsvToggle = runtime.CreateToggle("Write perf.csv every 60 s", "perfCsv");
+		m_PerfCsvToggle.SetChecked(IA_Profiler.IsCsvEnabled());
+		m_PerfCsvToggle.GetOnChanged().Insert(OnPerfCsvChanged);
+
+		ref MUI_Button refreshBtn = runtime.CreateButton("Refresh", "perfRefresh");
+		refreshBtn.GetOnClicked().Insert(RequestPerfReport);
+
+		ref MUI_Button dumpLogBtn = runtime.CreateButton("Dump log ring", "perfDumpLog");
+		dumpLogBtn.GetOnClicked().Insert(OnDumpLog);
+
+		ref MUI_Row perfBtns = runtime.CreateRow("perfBtns");
+		perfBtns.SetGap(12);
+		perfBtns.AddChild(refreshBtn);
+		perfBtns.AddChild(dumpLogBtn);
+
+		m_PagePerf.AddChild(m_PerfEnableToggle);
+		m_PagePerf.AddChild(m_PerfCsvToggle);
+		m_PagePerf.AddChild(perfBtns);
+
+		IA_Profiler.GetOnReport().Insert(OnPerfReport);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void RequestPerfReport()
+	{
+		SCR_PlayerController pc = SCR_PlayerController.Cast(GetGame().GetPlayerController());
+		if (pc)
+			pc.IA_AskPerfReport();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void OnDumpLog()
+	{
+		SCR_PlayerController pc = SCR_PlayerController.Cast(GetGame().GetPlayerController());
+		if (!pc)
+			return;
+
+		pc.IA_AskDumpLog();
+		SCR_HintManagerComponent.ShowCustomHint(
+			"Server log ring written to the server console and " + IA_Log.DUMP_PATH + ".",
+			"ADMIN CONFIG",
+			6
+		);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void OnPerfEnableChanged()
+	{
+		if (m_bSyncingPerf || !m_PerfEnableToggle)
+			return;
+
+		SCR_PlayerController pc = SCR_PlayerController.Cast(GetGame().GetPlayerController());
+		if (pc)
+			pc.IA_AskSetProfiling(m_PerfEnableToggle.IsChecked());
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void OnPerfCsvChanged()
+	{
+		if (m_bSyncingPerf || !m_PerfCsvToggle)
+			return;
+
+		SCR_PlayerController pc = SCR_PlayerController.Cast(GetGame().GetPlayerController());
+		if (pc)
+			pc.IA_AskSetPerfCsv(m_PerfCsvToggle.IsChecked());
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void OnPerfReport()
+	{
+		array<string> lines = IA_Profiler.GetLastReport();
+		int count = m_aPerfRows.Count();
+		for (int i = 0; i < count; i++)
+		{
+			if (i < lines.Count())
+				m_aPerfRows[i].SetText(lines[i]);
+			else if (i == 0 && !IA_Profiler.IsEnabled())
+				m_aPerfRows[i].SetText("Sampling is off");
+			else if (i == 0)
+				m_aPerfRows[i].SetText("No samples yet");
+			else
+				m_aPerfRows[i].SetText("");
+		}
+
+		m_bSyncingPerf = true;
+		if (m_PerfEnableToggle)
+			m_PerfEnableToggle.SetChecked(IA_Profiler.IsEnabled());
+		if (m_PerfCsvToggle)
+			m_PerfCsvToggle.SetChecked(IA_Profiler.IsCsvEnabled());
+		m_bSyncingPerf = false;
+	}
+
 	//------------------------------------------------------------------------------------------------
 	protected MUI_Panel MakePage(notnull MUI_Runtime runtime, string name)
 	{
@@ -273,6 +406,11 @@ class IA_AdminConfigMenu : MUI_MenuBase
 			m_PageArty.SetVisible(index == 2);
 		if (m_PageHq)
 			m_PageHq.SetVisible(index == 3);
+		if (m_PagePerf)
+			m_PagePerf.SetVisible(index == 4);
+
+		if (index == 4)
+			RequestPerfReport();
 	}
 
 	//------------------------------------------------------------------------------------------------